@@ -741,6 +741,10 @@ static const char conf_key_dist_type[]        = "dist_type";
 static const char conf_key_dist_parm[]        = "dist_parm";
 static const char conf_key_inst_bias_scale[]  = "inst_bias_scale";
 static const char conf_key_inst_bias_offset[] = "inst_bias_offset";
+static const char conf_key_member_storage[]   = "member_storage";
+static const char conf_key_float32[]          = "float32";
+static const char conf_key_mapped[]           = "mapped";
+static const char conf_key_cache_mb[]         = "cache_mb";
 
 // Distribution options
 static const char conf_val_normal[]      = "NORMAL";
@@ -787,6 +791,7 @@ static const char conf_key_vif_flag[]          = "vif_flag";
 static const char conf_key_wmo_sqrt_stats[]    = "wmo_sqrt_stats";
 static const char conf_key_wmo_fisher_stats[]  = "wmo_fisher_stats";
 static const char conf_key_jobs[]              = "jobs";
+static const char conf_key_parallel_jobs[]     = "parallel_jobs";
 
 //
 // MODE specific parameter key names
@@ -974,6 +979,8 @@ static const char conf_key_write_pixel_age[] = "write_pixel_age";
 
 static const char conf_key_output_stats[] = "output_stats";
 static const char conf_key_block_size[]   = "block_size";
+static const char conf_key_single_pass[]  = "single_pass";
+static const char conf_key_max_mem_mb[]   = "max_mem_mb";
 
 //
 // Plot-Point-Obs specific parameter values names
@@ -194,10 +194,19 @@ Number n;
 n.d = x;
 n.is_int = false;
 
+   //
+   //  the calculator is shared, so only one thread may run it at a time
+   //
+
+#pragma omp critical(met_user_func)
+{
+
 hp.run( V, &n);
 
 n = hp.pop();
 
+}
+
 return ( as_double(n) );
 
 }
@@ -359,9 +368,22 @@ Number UserFunc_MultiArg::operator()(const Number * n) const
 
 {
 
+Number result;
+
+   //
+   //  the calculator is shared, so only one thread may run it at a time
+   //
+
+#pragma omp critical(met_user_func)
+{
+
 hp.run( V, n);
 
-return ( hp.pop() );
+result = hp.pop();
+
+}
+
+return ( result );
 
 }
 
@@ -14,6 +14,11 @@ using namespace std;
 
 
 #include <cstdio>
+#include <sstream>
+
+#ifdef _OPENMP
+   #include <omp.h>
+#endif
 
 #include "logger.h"
 
@@ -49,6 +54,57 @@ LoggerError Error;
 LoggerWarning Warning;
 
 
+//////////////////////////////////////////////////////////////////
+
+
+   //
+   //  state of the message being written by each thread
+   //
+
+static int  message_level       = DefaultMessageLevel;
+
+static bool need_to_output_type = false;
+
+static string * message_buf     = (string *) 0;
+
+#pragma omp threadprivate(message_level, need_to_output_type, message_buf)
+
+
+//////////////////////////////////////////////////////////////////
+
+
+   //
+   //  holds the logger lock for the lifetime of the object, so that
+   //  output from multiple threads is not interleaved
+   //
+
+class LoggerLock {
+
+   public:
+
+      LoggerLock();
+     ~LoggerLock();
+
+};
+
+
+#ifdef _OPENMP
+
+static omp_nest_lock_t logger_omp_lock;
+
+static bool logger_omp_lock_is_init = (omp_init_nest_lock(&logger_omp_lock), true);
+
+LoggerLock::LoggerLock()  { omp_set_nest_lock(&logger_omp_lock);   }
+LoggerLock::~LoggerLock() { omp_unset_nest_lock(&logger_omp_lock); }
+
+#else
+
+LoggerLock::LoggerLock()  { }
+LoggerLock::~LoggerLock() { }
+
+#endif
+
+
 //////////////////////////////////////////////////////////////////
 
 
@@ -443,6 +499,8 @@ void Logger::init_from_scratch()
 
 void Logger::clear()
 {
+   flush_message();
+
    if (out)
    {
       out->flush();
@@ -458,7 +516,7 @@ void Logger::clear()
    fflush(stderr);
    fflush(stdout);
 
-   message_level.clear();
+   message_level = DefaultMessageLevel;
 
    VerbosityLevel = DefaultVerbosityLevel;
 
@@ -474,7 +532,7 @@ void Logger::dump(ostream & dump_out, int depth) const
 {
    Indent prefix(depth);
 
-   dump_out << prefix << "MsgLevel = \"" << message_level.value() << "\"\n";
+   dump_out << prefix << "MsgLevel = \"" << message_level << "\"\n";
 
    dump_out << prefix << "VerbosityLevel = \"" << VerbosityLevel << "\"\n";
 
@@ -563,161 +621,29 @@ void Logger::open_log_file(const ConcatString s)
 
 Logger & Logger::operator<<(const string s)
 {
-   ConcatString msg;
-   StringArray messages;
-   int i, len, msg_len;
-   
+   string::size_type beg, end;
 
-   if (s.empty())
-   {
       //
-      // if s is null or the length of s is zero, then print "(nul)"
+      // if the length of s is zero, then print "(nul)"
       //
-     messages.add((string)"(nul)");
-   }
-   else
+   if (s.empty())
    {
-     //     StringArray temp = msg.split("\n");
-     
-     //     messages.add(temp);
-
-     len = s.length();
-      
-         //
-         // Search through s, looking for newline characters. Copy each
-         // non_newline character to msg. When we reach a newline character
-         // put it in msg, then put that msg into the StringArray messages,
-         // clear msg, and continue. When we have found all the sub-messages
-         // in s, then write them out to the appropriate places putting a
-         // message type header at the beginning of each line.
-         //
-
-      for (i = 0; i < len; i++)
-      {
-            //
-            // put the next character into the ConcatString msg
-            //
-	//         tmp[0] = s[i];
-         msg.add(s[i]);
-
-         if (s[i] == '\n')
-         {
-               //
-               // this was a newline, so
-               // put msg into the StringArray messages
-               //
-	   messages.add((string)msg);
-
-               //
-               // clear msg, and continue checking s
-               //
-            msg.clear();
-
-         }
-
-      }
-         //
-         // Check if the last string did not end in '\n'.
-         // If it did not then we need to add it to messages.
-         //
-
-      if (s.length() > 0)
-      {
-         if (s[s.length() - 1] != '\n')
-         {
-	   messages.add((string)msg);
-            msg.clear();
-
-         }
-
-      }
-
-   }  // end of else s is not empty
+      write_line("(nul)");
+
+      return (*this);
+   }
 
       //
-      // now we've broken the string s up into substrings each of
-      // which ends with a single newline or no newline if at the
-      // end of s, so we will write each substring out prepending
-      // the "ERROR:", "WARNING:", or "DEBUG num:" string in front
-      // if needed.
+      // write each line of s separately, so that the "ERROR:",
+      // "WARNING:", or "DEBUG num:" string is prepended to each one
       //
-   for (i = 0; i < messages.n_elements(); i++)
+   for (beg = 0; beg < s.length(); beg = end)
    {
-         //
-         // prepend the message type if needed
-         //
-      if (need_to_output_type)
-      {
-         write_msg_type();
-         need_to_output_type = false;
-      }
-
-         //
-         // if the message level is -1, then this is an ERROR type message,
-         // so write it to cerr
-         //
-      if (message_level == ErrorMessageLevel)
-      {
-         cerr << messages[i] << flush;
-
-         fflush(stderr);
-
-            //
-            // if the file is open, then also write it to the log file
-            //
-         if (is_open())
-            (*out) << messages[i] << flush;
-
-      }
-         //
-         // else if the message level is 0, then this is a WARNING type message,
-         // so write it to cerr
-         //
-      else if (message_level == WarningMessageLevel)
-      {
-         cerr << messages[i] << flush;
-
-         fflush(stderr);
-
-            //
-            // if the file is open, then also write it to the log file
-            //
-         if (is_open())
-            (*out) << messages[i] << flush;
-
-      }
-         //
-         // else if the message level is greater than 0, then this is a DEBUG
-         // type message, so write it to cout, but only if it is less than or
-         // equal to the verbosity level
-         //
-      else
-      {
-         if (message_level <= VerbosityLevel)
-         {
-            cout << messages[i] << flush;
-
-            fflush(stdout);
-
-            //
-            // if the file is open, then also write it to the log file
-            //
-         if (is_open())
-               (*out) << messages[i] << flush;
-
-         }
-      }
+      end = s.find('\n', beg);
 
-         //
-         // only want to set this to true if there is a newline at the end
-         // of this message.
-         //
-      msg = messages[i];
-      msg_len = msg.length();
-
-      if (msg[msg_len - 1] == '\n')
-         need_to_output_type = true;
+      end = (end == string::npos ? s.length() : end + 1);
 
+      write_line(s.substr(beg, end - beg));
    }
 
    return (*this);
@@ -725,228 +651,34 @@ Logger & Logger::operator<<(const string s)
 }
 
 
-
 //////////////////////////////////////////////////////////////////
 
+
 Logger & Logger::operator<<(const char * s)
 {
-   ConcatString msg;
-   StringArray messages;
-   char tmp[2];
-   int i, len, msg_len;
-   
-   memset(tmp, 0, sizeof(tmp));
-
-   if (!s || !*s)
-   {
       //
-      // if s is null or the length of s is zero, then print "(nul)"
+      // if s is null, then print "(nul)"
       //
-      messages.add("(nul)");
-   }
+   if (!s)
+      (*this) << string();
    else
-   {
-
-      len = strlen(s);
-      
-         //
-         // Search through s, looking for newline characters. Copy each
-         // non_newline character to msg. When we reach a newline character
-         // put it in msg, then put that msg into the StringArray messages,
-         // clear msg, and continue. When we have found all the sub-messages
-         // in s, then write them out to the appropriate places putting a
-         // message type header at the beginning of each line.
-         //
-      for (i = 0; i < len; i++)
-      {
-            //
-            // put the next character into the ConcatString msg
-            //
-         tmp[0] = s[i];
-         msg.add(tmp);
-
-         if (s[i] == '\n')
-         {
-               //
-               // this was a newline, so
-               // put msg into the StringArray messages
-               //
-            messages.add(msg);
-
-               //
-               // clear msg, and continue checking s
-               //
-            msg.clear();
-
-         }
-
-      }
-
-         //
-         // Check if the last string did not end in '\n'.
-         // If it did not then we need to add it to messages.
-         //
-      if (msg.length() > 0)
-      {
-         if (msg[msg.length() - 1] != '\n')
-         {
-            messages.add(msg);
-            msg.clear();
-
-         }
-
-      }
-
-   }  // end of else s is not empty
-
-      //
-      // now we've broken the string s up into substrings each of
-      // which ends with a single newline or no newline if at the
-      // end of s, so we will write each substring out prepending
-      // the "ERROR:", "WARNING:", or "DEBUG num:" string in front
-      // if needed.
-      //
-   for (i = 0; i < messages.n_elements(); i++)
-   {
-         //
-         // prepend the message type if needed
-         //
-      if (need_to_output_type)
-      {
-         write_msg_type();
-         need_to_output_type = false;
-      }
-
-         //
-         // if the message level is -1, then this is an ERROR type message,
-         // so write it to cerr
-         //
-      if (message_level == ErrorMessageLevel)
-      {
-         cerr << messages[i] << flush;
-
-         fflush(stderr);
-
-            //
-            // if the file is open, then also write it to the log file
-            //
-         if (is_open())
-            (*out) << messages[i] << flush;
-
-      }
-         //
-         // else if the message level is 0, then this is a WARNING type message,
-         // so write it to cerr
-         //
-      else if (message_level == WarningMessageLevel)
-      {
-         cerr << messages[i] << flush;
-
-         fflush(stderr);
-
-            //
-            // if the file is open, then also write it to the log file
-            //
-         if (is_open())
-            (*out) << messages[i] << flush;
-
-      }
-         //
-         // else if the message level is greater than 0, then this is a DEBUG
-         // type message, so write it to cout, but only if it is less than or
-         // equal to the verbosity level
-         //
-      else
-      {
-         if (message_level <= VerbosityLevel)
-         {
-            cout << messages[i] << flush;
-
-            fflush(stdout);
-
-            //
-            // if the file is open, then also write it to the log file
-            //
-         if (is_open())
-               (*out) << messages[i] << flush;
-
-         }
-      }
-
-         //
-         // only want to set this to true if there is a newline at the end
-         // of this message.
-         //
-      msg = messages[i];
-      msg_len = msg.length();
-
-      if (msg[msg_len - 1] == '\n')
-         need_to_output_type = true;
-
-   }
+      (*this) << string(s);
 
    return (*this);
 
 }
 
 
-Logger & Logger::operator<<(const int n)
-{
-      //
-      // if the message level is -1, then this is an ERROR type message,
-      // so write it to cerr
-      //
-   if (message_level == ErrorMessageLevel)
-   {
-      cerr << n << flush;
-
-      fflush(stderr);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << n << flush;
-
-   }
-      //
-      // else if the message level is 0, then this is a WARNING type message,
-      // so write it to cerr
-      //
-   else if (message_level == WarningMessageLevel)
-   {
-      cerr << n << flush;
-
-      fflush(stderr);
+//////////////////////////////////////////////////////////////////
 
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << n << flush;
 
-   }
-      //
-      // else if the message level is greater than 0, then this is a DEBUG
-      // type message, so write it to cout, but only if it is less than or
-      // equal to the verbosity level
-      //
-   else
-   {
-      if (message_level <= VerbosityLevel)
-      {
-         cout << n << flush;
-
-         fflush(stdout);
+Logger & Logger::operator<<(const int n)
+{
+   ostringstream str;
 
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-            (*out) << n << flush;
+   str << n;
 
-      }
-   }
+   put_text(str.str());
 
    return (*this);
 
@@ -958,61 +690,11 @@ Logger & Logger::operator<<(const int n)
 
 Logger & Logger::operator<<(const unsigned int n)
 {
-      //
-      // if the message level is -1, then this is an ERROR type message,
-      // so write it to cerr
-      //
-   if (message_level == ErrorMessageLevel)
-   {
-      cerr << n << flush;
-
-      fflush(stderr);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << n << flush;
+   ostringstream str;
 
-   }
-      //
-      // else if the message level is 0, then this is a WARNING type message,
-      // so write it to cerr
-      //
-   else if (message_level == WarningMessageLevel)
-   {
-      cerr << n << flush;
-
-      fflush(stderr);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << n << flush;
-
-   }
-      //
-      // else if the message level is greater than 0, then this is a DEBUG
-      // type message, so write it to cout, but only if it is less than or
-      // equal to the verbosity level
-      //
-   else
-   {
-      if (message_level <= VerbosityLevel)
-      {
-         cout << n << flush;
+   str << n;
 
-         fflush(stdout);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-            (*out) << n << flush;
-
-      }
-   }
+   put_text(str.str());
 
    return (*this);
 
@@ -1024,126 +706,27 @@ Logger & Logger::operator<<(const unsigned int n)
 
 Logger & Logger::operator<<(const long l)
 {
-      //
-      // if the message level is -1, then this is an ERROR type message,
-      // so write it to cerr
-      //
-   if (message_level == ErrorMessageLevel)
-   {
-      cerr << l << flush;
+   ostringstream str;
 
-      fflush(stderr);
+   str << l;
 
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << l << flush;
-
-   }
-      //
-      // else if the message level is 0, then this is a WARNING type message,
-      // so write it to cerr
-      //
-   else if (message_level == WarningMessageLevel)
-   {
-      cerr << l << flush;
-
-      fflush(stderr);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << l << flush;
-
-   }
-      //
-      // else if the message level is greater than 0, then this is a DEBUG
-      // type message, so write it to cout, but only if it is less than or
-      // equal to the verbosity level
-      //
-   else
-   {
-      if (message_level <= VerbosityLevel)
-      {
-         cout << l << flush;
-
-         fflush(stdout);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-            (*out) << l << flush;
-
-      }
-   }
+   put_text(str.str());
 
    return (*this);
 
 }
 
+
 //////////////////////////////////////////////////////////////////
 
 
 Logger & Logger::operator<<(const unsigned long l)
 {
-      //
-      // if the message level is -1, then this is an ERROR type message,
-      // so write it to cerr
-      //
-   if (message_level == ErrorMessageLevel)
-   {
-      cerr << l << flush;
+   ostringstream str;
 
-      fflush(stderr);
+   str << l;
 
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << l << flush;
-
-   }
-      //
-      // else if the message level is 0, then this is a WARNING type message,
-      // so write it to cerr
-      //
-   else if (message_level == WarningMessageLevel)
-   {
-      cerr << l << flush;
-
-      fflush(stderr);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << l << flush;
-
-   }
-      //
-      // else if the message level is greater than 0, then this is a DEBUG
-      // type message, so write it to cout, but only if it is less than or
-      // equal to the verbosity level
-      //
-   else
-   {
-      if (message_level <= VerbosityLevel)
-      {
-         cout << l << flush;
-
-         fflush(stdout);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-            (*out) << l << flush;
-
-      }
-   }
+   put_text(str.str());
 
    return (*this);
 
@@ -1155,61 +738,11 @@ Logger & Logger::operator<<(const unsigned long l)
 
 Logger & Logger::operator<<(const long long l)
 {
-      //
-      // if the message level is -1, then this is an ERROR type message,
-      // so write it to cerr
-      //
-   if (message_level == ErrorMessageLevel)
-   {
-      cerr << l << flush;
-
-      fflush(stderr);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << l << flush;
+   ostringstream str;
 
-   }
-      //
-      // else if the message level is 0, then this is a WARNING type message,
-      // so write it to cerr
-      //
-   else if (message_level == WarningMessageLevel)
-   {
-      cerr << l << flush;
-
-      fflush(stderr);
+   str << l;
 
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << l << flush;
-
-   }
-      //
-      // else if the message level is greater than 0, then this is a DEBUG
-      // type message, so write it to cout, but only if it is less than or
-      // equal to the verbosity level
-      //
-   else
-   {
-      if (message_level <= VerbosityLevel)
-      {
-         cout << l << flush;
-
-         fflush(stdout);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-            (*out) << l << flush;
-
-      }
-   }
+   put_text(str.str());
 
    return (*this);
 
@@ -1221,61 +754,11 @@ Logger & Logger::operator<<(const long long l)
 
 Logger & Logger::operator<<(const unsigned long long l)
 {
-      //
-      // if the message level is -1, then this is an ERROR type message,
-      // so write it to cerr
-      //
-   if (message_level == ErrorMessageLevel)
-   {
-      cerr << l << flush;
+   ostringstream str;
 
-      fflush(stderr);
+   str << l;
 
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << l << flush;
-
-   }
-      //
-      // else if the message level is 0, then this is a WARNING type message,
-      // so write it to cerr
-      //
-   else if (message_level == WarningMessageLevel)
-   {
-      cerr << l << flush;
-
-      fflush(stderr);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << l << flush;
-
-   }
-      //
-      // else if the message level is greater than 0, then this is a DEBUG
-      // type message, so write it to cout, but only if it is less than or
-      // equal to the verbosity level
-      //
-   else
-   {
-      if (message_level <= VerbosityLevel)
-      {
-         cout << l << flush;
-
-         fflush(stdout);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-            (*out) << l << flush;
-
-      }
-   }
+   put_text(str.str());
 
    return (*this);
 
@@ -1287,61 +770,11 @@ Logger & Logger::operator<<(const unsigned long long l)
 
 Logger & Logger::operator<<(const double d)
 {
-      //
-      // if the message level is -1, then this is an ERROR type message,
-      // so write it to cerr
-      //
-   if (message_level == ErrorMessageLevel)
-   {
-      cerr << d << flush;
+   ostringstream str;
 
-      fflush(stderr);
+   str << d;
 
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << d << flush;
-
-   }
-      //
-      // else if the message level is 0, then this is a WARNING type message,
-      // so write it to cerr
-      //
-   else if (message_level == WarningMessageLevel)
-   {
-      cerr << d << flush;
-
-      fflush(stderr);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << d << flush;
-
-   }
-      //
-      // else if the message level is greater than 0, then this is a DEBUG
-      // type message, so write it to cout, but only if it is less than or
-      // equal to the verbosity level
-      //
-   else
-   {
-      if (message_level <= VerbosityLevel)
-      {
-         cout << d << flush;
-
-         fflush(stdout);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-            (*out) << d << flush;
-
-      }
-   }
+   put_text(str.str());
 
    return (*this);
 
@@ -1353,61 +786,11 @@ Logger & Logger::operator<<(const double d)
 
 Logger & Logger::operator<<(const char c)
 {
-      //
-      // if the message level is -1, then this is an ERROR type message,
-      // so write it to cerr
-      //
-   if (message_level == ErrorMessageLevel)
-   {
-      cerr << c << flush;
+   ostringstream str;
 
-      fflush(stderr);
+   str << c;
 
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << c << flush;
-
-   }
-      //
-      // else if the message level is 0, then this is a WARNING type message,
-      // so write it to cerr
-      //
-   else if (message_level == WarningMessageLevel)
-   {
-      cerr << c << flush;
-
-      fflush(stderr);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << c << flush;
-
-   }
-      //
-      // else if the message level is greater than 0, then this is a DEBUG
-      // type message, so write it to cout, but only if it is less than or
-      // equal to the verbosity level
-      //
-   else
-   {
-      if (message_level <= VerbosityLevel)
-      {
-         cout << c << flush;
-
-         fflush(stdout);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-            (*out) << c << flush;
-
-      }
-   }
+   put_text(str.str());
 
    return (*this);
 
@@ -1419,61 +802,11 @@ Logger & Logger::operator<<(const char c)
 
 Logger & Logger::operator<<(const bool b)
 {
-      //
-      // if the message level is -1, then this is an ERROR type message,
-      // so write it to cerr
-      //
-   if (message_level == ErrorMessageLevel)
-   {
-      cerr << b << flush;
-
-      fflush(stderr);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << b << flush;
-
-   }
-      //
-      // else if the message level is 0, then this is a WARNING type message,
-      // so write it to cerr
-      //
-   else if (message_level == WarningMessageLevel)
-   {
-      cerr << b << flush;
-
-      fflush(stderr);
+   ostringstream str;
 
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << b << flush;
+   str << b;
 
-   }
-      //
-      // else if the message level is greater than 0, then this is a DEBUG
-      // type message, so write it to cout, but only if it is less than or
-      // equal to the verbosity level
-      //
-   else
-   {
-      if (message_level <= VerbosityLevel)
-      {
-         cout << b << flush;
-
-         fflush(stdout);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-            (*out) << b << flush;
-
-      }
-   }
+   put_text(str.str());
 
    return (*this);
 
@@ -1509,61 +842,7 @@ Logger & Logger::operator<<(const Indent & i)
       //
       // write the indentation string out
       //
-      //
-      // if the message level is -1, then this is an ERROR type message,
-      // so write it to cerr
-      //
-   if (message_level == ErrorMessageLevel)
-   {
-      cerr << tmp_str << flush;
-
-      fflush(stderr);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << tmp_str << flush;
-
-   }
-      //
-      // else if the message level is 0, then this is a WARNING type message,
-      // so write it to cerr
-      //
-   else if (message_level == WarningMessageLevel)
-   {
-      cerr << tmp_str << flush;
-
-      fflush(stderr);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << tmp_str << flush;
-
-   }
-      //
-      // else if the message level is greater than 0, then this is a DEBUG
-      // type message, so write it to cout, but only if it is less than or
-      // equal to the verbosity level
-      //
-   else
-   {
-      if (message_level <= VerbosityLevel)
-      {
-         cout << tmp_str << flush;
-
-         fflush(stdout);
-
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-            (*out) << tmp_str << flush;
-
-      }
-   }
+   put_text(tmp_str.text());
 
    return (*this);
 
@@ -1575,10 +854,15 @@ Logger & Logger::operator<<(const Indent & i)
 
 Logger & Logger::operator<<(const MsgLevel & m)
 {
+      //
+      // finish any message left without a newline at the old level
+      //
+   flush_message();
+
       //
       // set this logger's message_level value from m
       //
-   message_level = m;
+   message_level = m.value();
 
    write_msg_type();
 
@@ -1632,92 +916,143 @@ Logger & Logger::operator<<(const LoggerDebug d)
 
 void Logger::write_msg_type()
 {  
+   ostringstream str;
+
       //
-      // if the message level is -1, then this is an ERROR type message,
-      // so write it to cerr
+      // if the message level is -1, then this is an ERROR type message
       //
    if (message_level == ErrorMessageLevel)
-   {
-      cerr << "ERROR  : " << flush;
+      str << "ERROR  : ";
+      //
+      // else if the message level is 0, then this is a WARNING type message
+      //
+   else if (message_level == WarningMessageLevel)
+      str << "WARNING: ";
+      //
+      // else if the message level is greater than 0, then this is a DEBUG
+      // type message
+      //
+   else
+      str << "DEBUG " << message_level << ": ";
 
-      fflush(stderr);
+   put_text(str.str());
 
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << "ERROR  : " << flush;
+}
 
-   }
+
+//////////////////////////////////////////////////////////////////
+
+
+void Logger::write_line(const string & s)
+{
       //
-      // else if the message level is 0, then this is a WARNING type message,
-      // so write it to cerr
+      // prepend the message type if needed
       //
-   else if (message_level == WarningMessageLevel)
+   if (need_to_output_type)
    {
-      cerr << "WARNING: " << flush;
+      write_msg_type();
+      need_to_output_type = false;
+   }
 
-      fflush(stderr);
+   put_text(s);
+
+      //
+      // only want to set this to true if there is a newline at the end
+      // of this message.
+      //
+   if (s[s.length() - 1] == '\n')
+      need_to_output_type = true;
 
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-         (*out) << "WARNING: " << flush;
+}
 
-   }
+
+//////////////////////////////////////////////////////////////////
+
+
+void Logger::put_text(const string & s)
+{
       //
-      // else if the message level is greater than 0, then this is a DEBUG
-      // type message, so write it to cout, but only if it is less than or
-      // equal to the verbosity level
+      // DEBUG messages are only written if the message level is less
+      // than or equal to the verbosity level
       //
-   else
+   if (message_level > WarningMessageLevel && message_level > VerbosityLevel)
+      return;
+
+#ifdef _OPENMP
+
+      //
+      // within a parallel region, collect each thread's message and
+      // write it whole once it ends with a newline, so that messages
+      // from multiple threads are not interleaved mid-line
+      //
+   if (omp_in_parallel())
    {
-      if (message_level <= VerbosityLevel)
-      {
-         cout << "DEBUG " << message_level << ": " << flush;
+      if (!message_buf) message_buf = new string;
 
-         fflush(stdout);
+      message_buf->append(s);
 
-         //
-         // if the file is open, then also write it to the log file
-         //
-      if (is_open())
-            (*out) << "DEBUG " << message_level << ": " << flush;
+      if (!s.empty() && s[s.length() - 1] == '\n')
+         flush_message();
 
-      }
+      return;
    }
 
+#endif
+
+   flush_message();
+
+   write_out(s);
+
 }
 
 
 //////////////////////////////////////////////////////////////////
 
 
-   //
-   // Code for Miscellaneous Functions
-   //
+void Logger::flush_message()
+{
+   if (message_buf && !message_buf->empty())
+   {
+      write_out(*message_buf);
+
+      message_buf->clear();
+   }
+
+}
 
 
 //////////////////////////////////////////////////////////////////
 
 
-MsgLevel & level(const int n)
+void Logger::write_out(const string & s)
 {
+   LoggerLock lock;
+
       //
-      // create a MsgLevel object and initialize it to n
+      // if the message level is -1 or 0, then this is an ERROR or
+      // WARNING type message, so write it to cerr
       //
-   MsgLevel m(n);
+   if (message_level <= WarningMessageLevel)
+   {
+      cerr << s << flush;
 
+      fflush(stderr);
+   }
       //
-      // assign the new object to the one sent in
+      // else this is a DEBUG type message, so write it to cout
       //
-   Global_Level = m;
+   else
+   {
+      cout << s << flush;
+
+      fflush(stdout);
+   }
 
       //
-      // return a reference to the MsgLevel object
+      // if the file is open, then also write it to the log file
       //
-   return (Global_Level);
+   if (is_open())
+      (*out) << s << flush;
 
 }
 
@@ -1725,8 +1060,15 @@ MsgLevel & level(const int n)
 //////////////////////////////////////////////////////////////////
 
 
-MsgLevel & Debug(const int n)
+   //
+   // Code for Miscellaneous Functions
+   //
+
+
+//////////////////////////////////////////////////////////////////
+
 
+MsgLevel level(const int n)
 {
       //
       // create a MsgLevel object and initialize it to n
@@ -1734,14 +1076,30 @@ MsgLevel & Debug(const int n)
    MsgLevel m(n);
 
       //
-      // assign the new object to the one sent in
+      // return a copy rather than a reference to Global_Level,
+      // which would be shared by all threads
       //
-   Global_Level = m;
+   return (m);
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+MsgLevel Debug(const int n)
+
+{
+      //
+      // create a MsgLevel object and initialize it to n
+      //
+   MsgLevel m(n);
 
       //
-      // return a reference to the MsgLevel object
+      // return a copy rather than a reference to Global_Level,
+      // which would be shared by all threads
       //
-   return (Global_Level);
+   return (m);
 
 }
 
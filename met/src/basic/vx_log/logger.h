@@ -186,9 +186,9 @@ inline LoggerDebug::operator int () const { return (Value); }
 
 class Logger
 {
-   friend MsgLevel & level(const int);
+   friend MsgLevel level(const int);
    // friend LoggerDebug & Debug(const int);
-   friend MsgLevel & Debug(const int);
+   friend MsgLevel Debug(const int);
 
    private:
 
@@ -197,9 +197,12 @@ class Logger
 
    protected:
 
-      bool need_to_output_type;
-
-      MsgLevel message_level;
+         //
+         // The message level and whether the message type must be
+         // written are stored for each thread in logger.cc.  Within
+         // OpenMP parallel regions, each thread's message is collected
+         // and written whole, while holding a lock, at the newline.
+         //
 
          //
          // VerbosityLevel must be 0 or greater.
@@ -231,6 +234,14 @@ class Logger
 
       void write_msg_type();
 
+      void write_line(const std::string &);
+
+      void put_text(const std::string &);
+
+      void flush_message();
+
+      void write_out(const std::string &);
+
    public:
 
       Logger();
@@ -303,8 +314,8 @@ inline bool Logger::is_open() const { return (out != 0); }
 //////////////////////////////////////////////////////////////////
 
 
-extern MsgLevel & level(const int);
-extern MsgLevel & Debug(const int);
+extern MsgLevel level(const int);
+extern MsgLevel Debug(const int);
 extern LoggerError Error;
 extern LoggerWarning Warning;
 
@@ -0,0 +1,409 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+using namespace std;
+
+
+//////////////////////////////////////////////////////////////////
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "perf_timer.h"
+#include "logger.h"
+
+
+//////////////////////////////////////////////////////////////////
+
+
+PerfProfile mperf;
+
+
+//////////////////////////////////////////////////////////////////
+
+
+static void write_perf_report_at_exit();
+
+static void write_perf_line(ostream &, const char *program, const char *type,
+                            const PerfEntry &);
+
+
+//////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for class PerfProfile
+   //
+
+
+//////////////////////////////////////////////////////////////////
+
+
+PerfProfile::PerfProfile()
+{
+   init_from_scratch();
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+PerfProfile::~PerfProfile()
+{
+   clear();
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+void PerfProfile::init_from_scratch()
+{
+   clear();
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+void PerfProfile::clear()
+{
+   Enabled = false;
+
+   Program.clear();
+   OutFile.clear();
+
+   StartWall = StartCpu = 0.0;
+
+   Entry.clear();
+   EntryIndex.clear();
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+void PerfProfile::init(const char *program)
+{
+   const char *env = getenv(met_profile_env);
+
+      //
+      // check if profiling was requested
+      //
+   if (!env || !*env) return;
+
+   if (Enabled)
+   {
+      mlog << Warning << "\nPerfProfile::init() -> "
+           << "profiling already enabled for \"" << Program << "\"\n\n";
+      return;
+   }
+
+   Enabled = true;
+
+   Program = program;
+   OutFile = env;
+
+   StartWall = perf_wall_seconds();
+   StartCpu  = perf_cpu_seconds();
+
+   atexit(write_perf_report_at_exit);
+
+   mlog << Debug(2) << "Writing profile report to \"" << OutFile
+        << "\" at exit.\n";
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+PerfEntry & PerfProfile::entry(const char *name, bool is_counter)
+{
+   std::string s = (name ? name : "");
+
+      //
+      // keep the report whitespace-delimited
+      //
+   for (size_t i=0; i<s.length(); ++i)
+   {
+      if (s[i] == ' ' || s[i] == '\t' || s[i] == '\n') s[i] = '_';
+   }
+
+   std::map<std::string, int>::const_iterator it = EntryIndex.find(s);
+
+   if (it != EntryIndex.end()) return (Entry[it->second]);
+
+   PerfEntry e;
+
+   e.Name      = s;
+   e.IsCounter = is_counter;
+   e.Count     = 0;
+   e.WallSec   = e.CpuSec = 0.0;
+   e.MaxRssKb  = 0;
+
+   EntryIndex[s] = (int) Entry.size();
+   Entry.push_back(e);
+
+   return (Entry.back());
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+void PerfProfile::add_time(const char *name, double wall_sec, double cpu_sec)
+{
+   if (!Enabled) return;
+
+   const long rss = perf_max_rss_kb();
+
+#pragma omp critical(met_perf_profile)
+   {
+      PerfEntry & e = entry(name, false);
+
+      e.Count   += 1;
+      e.WallSec += wall_sec;
+      e.CpuSec  += cpu_sec;
+
+      if (rss > e.MaxRssKb) e.MaxRssKb = rss;
+   }
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+void PerfProfile::add_count(const char *name, long long n)
+{
+   if (!Enabled) return;
+
+#pragma omp critical(met_perf_profile)
+   {
+      entry(name, true).Count += n;
+   }
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+void PerfProfile::write_report(ostream & out) const
+{
+   PerfEntry total;
+
+   total.Name      = "total";
+   total.IsCounter = false;
+   total.Count     = 1;
+   total.WallSec   = perf_wall_seconds() - StartWall;
+   total.CpuSec    = perf_cpu_seconds()  - StartCpu;
+   total.MaxRssKb  = perf_max_rss_kb();
+
+   write_perf_line(out, Program.c_str(), "TOTAL", total);
+
+   for (size_t i=0; i<Entry.size(); ++i)
+   {
+      write_perf_line(out, Program.c_str(),
+                      (Entry[i].IsCounter ? "COUNTER" : "PHASE"), Entry[i]);
+   }
+
+   out.flush();
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+void PerfProfile::write_report() const
+{
+   if (!Enabled) return;
+
+   struct stat sbuf;
+   const bool is_new = (stat(OutFile.c_str(), &sbuf) != 0 || sbuf.st_size == 0);
+
+      //
+      // append so that the reports of a sequence of runs accumulate
+      //
+   ofstream out(OutFile.c_str(), ios::out | ios::app);
+
+   if (!out)
+   {
+      cerr << "\n\n  PerfProfile::write_report() -> unable to open profile file \""
+           << OutFile << "\"\n\n";
+      return;
+   }
+
+   if (is_new)
+   {
+      out << "PROGRAM          PID        TYPE     NAME                                 "
+          << "COUNT          WALL_SEC     CPU_SEC      MAX_RSS_KB\n";
+   }
+
+   write_report(out);
+
+   out.close();
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for class PerfTimer
+   //
+
+
+//////////////////////////////////////////////////////////////////
+
+
+PerfTimer::PerfTimer(const char *name)
+{
+   Running = mperf.is_enabled();
+
+   StartWall = StartCpu = 0.0;
+
+   if (!Running) return;
+
+   Name = name;
+
+   StartWall = perf_wall_seconds();
+   StartCpu  = perf_cpu_seconds();
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+PerfTimer::~PerfTimer()
+{
+   stop();
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+void PerfTimer::stop()
+{
+   if (!Running) return;
+
+   Running = false;
+
+   mperf.add_time(Name.c_str(), perf_wall_seconds() - StartWall,
+                  perf_cpu_seconds() - StartCpu);
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Utility functions
+   //
+
+
+//////////////////////////////////////////////////////////////////
+
+
+double perf_wall_seconds()
+{
+   struct timeval tv;
+
+   gettimeofday(&tv, 0);
+
+   return ((double) tv.tv_sec + 1.0e-6*tv.tv_usec);
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+double perf_cpu_seconds()
+{
+   return ((double) clock()/CLOCKS_PER_SEC);
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+long perf_max_rss_kb()
+{
+   struct rusage usage;
+
+   if (getrusage(RUSAGE_SELF, &usage) != 0) return (-1);
+
+#ifdef __APPLE__
+   return ((long) (usage.ru_maxrss/1024));   //  reported in bytes
+#else
+   return ((long) usage.ru_maxrss);          //  reported in kilobytes
+#endif
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+void write_perf_report_at_exit()
+{
+   mperf.write_report();
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
+
+void write_perf_line(ostream & out, const char *program, const char *type,
+                     const PerfEntry & e)
+{
+   char line[1024];
+
+   if (e.IsCounter)
+   {
+      snprintf(line, sizeof(line), "%-16s %-10d %-8s %-36s %-14lld %-12s %-12s %s\n",
+               program, (int) getpid(), type, e.Name.c_str(), e.Count,
+               "NA", "NA", "NA");
+   }
+   else
+   {
+      snprintf(line, sizeof(line), "%-16s %-10d %-8s %-36s %-14lld %-12.4f %-12.4f %ld\n",
+               program, (int) getpid(), type, e.Name.c_str(), e.Count,
+               e.WallSec, e.CpuSec, e.MaxRssKb);
+   }
+
+   out << line;
+
+}
+
+
+//////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,194 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+//////////////////////////////////////////////////////////////////
+
+
+#ifndef  __PERF_TIMER_H__
+#define  __PERF_TIMER_H__
+
+
+//////////////////////////////////////////////////////////////////
+
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "concat_string.h"
+
+
+//////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Environment variable naming the file to which the profile
+   //  report is appended when the program exits
+   //
+
+static const char met_profile_env[] = "MET_PROFILE";
+
+
+//////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Accumulated time for a named phase or value for a named counter
+   //
+
+struct PerfEntry {
+
+   std::string Name;
+
+   bool IsCounter;
+
+   long long Count;    //  number of times timed, or counter value
+
+   double WallSec;     //  summed elapsed time
+   double CpuSec;      //  summed process cpu time
+
+   long MaxRssKb;      //  peak resident set size when last stopped
+
+};
+
+
+//////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Collects the phase timings and counters for the program and
+   //  writes them as a whitespace-delimited table at exit.  Nothing
+   //  is recorded unless the MET_PROFILE environment variable is set.
+   //
+
+class PerfProfile
+{
+   private:
+
+      PerfProfile(const PerfProfile &);
+      PerfProfile & operator=(const PerfProfile &);
+
+   protected:
+
+      bool Enabled;
+
+      ConcatString Program;
+      ConcatString OutFile;
+
+      double StartWall;
+      double StartCpu;
+
+      std::vector<PerfEntry> Entry;
+
+      std::map<std::string, int> EntryIndex;
+
+      void init_from_scratch();
+
+      PerfEntry & entry(const char *, bool is_counter);
+
+   public:
+
+      PerfProfile();
+     ~PerfProfile();
+
+      void clear();
+
+         //
+         // get stuff
+         //
+
+      bool is_enabled() const;
+
+         //
+         // set stuff
+         //
+
+         //  Enable profiling when MET_PROFILE is set and register
+         //  the report to be written at exit
+
+      void init(const char *program);
+
+         //
+         // do stuff
+         //
+
+      void add_time(const char *name, double wall_sec, double cpu_sec);
+
+      void add_count(const char *name, long long n = 1);
+
+      void write_report(std::ostream &) const;
+
+      void write_report() const;
+
+};
+
+
+//////////////////////////////////////////////////////////////////
+
+
+inline bool PerfProfile::is_enabled() const { return (Enabled); }
+
+
+//////////////////////////////////////////////////////////////////
+
+
+extern PerfProfile mperf;
+
+
+//////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Adds the time between its construction and destruction, or
+   //  the call to stop(), to the named phase of mperf
+   //
+
+class PerfTimer
+{
+   private:
+
+      PerfTimer(const PerfTimer &);
+      PerfTimer & operator=(const PerfTimer &);
+
+      std::string Name;
+
+      bool Running;
+
+      double StartWall;
+      double StartCpu;
+
+   public:
+
+      PerfTimer(const char *name);
+     ~PerfTimer();
+
+      void stop();
+
+};
+
+
+//////////////////////////////////////////////////////////////////
+
+
+extern double perf_wall_seconds();
+
+extern double perf_cpu_seconds();
+
+extern long   perf_max_rss_kb();
+
+
+//////////////////////////////////////////////////////////////////
+
+
+#endif   //  __PERF_TIMER_H__
+
+
+//////////////////////////////////////////////////////////////////
+
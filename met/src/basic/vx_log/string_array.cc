@@ -31,12 +31,23 @@ using namespace std;
 
 static const int stringarray_alloc_inc = 50;
 
+   //
+   //  arrays with at least this many elements are searched using
+   //  a sorted index rather than checking each element
+   //
+
+static const int stringarray_index_min = 16;
+
 
 ////////////////////////////////////////////////////////////////////////
 
 
 static int lex_comp (const void *, const void *);
 
+static void fold_case (std::string &);
+
+static bool equal_fold (const std::string &, const std::string &);
+
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -132,6 +143,8 @@ void StringArray::init_from_scratch()
 
 IgnoreCase = 0;
 
+IndexReady = 0;
+
 clear();
 
 
@@ -151,6 +164,8 @@ void StringArray::clear()
 
 s.clear();
 
+reset_index();
+
 return;
 
 }
@@ -238,6 +253,8 @@ void StringArray::set_ignore_case(const bool b)
 
 IgnoreCase = b;
 
+reset_index();
+
 return;
 
 }
@@ -252,6 +269,8 @@ void StringArray::add(const std::string text)
 
 s.push_back(text);
 
+if ( IndexReady )  index_add(n() - 1);
+
 return;
 
 }
@@ -266,8 +285,16 @@ void StringArray::add(const StringArray & a)
 
 if ( a.n() == 0 )  return;
 
+int j, n_prev = n();
+
 s.insert(s.end(), a.s.begin(), a.s.end());
- 
+
+if ( IndexReady )  {
+
+   for (j=n_prev; j<n(); ++j)  index_add(j);
+
+}
+
 return;
 
 }
@@ -322,6 +349,8 @@ void StringArray::set(int i, const std::string text)
 
 s[i] = text;
 
+reset_index();
+
 return;
 
 }
@@ -344,6 +373,8 @@ void StringArray::insert(int i, const char * text)
 
   s.insert(s.begin()+i, text);
 
+  reset_index();
+
   return;
 
 }
@@ -352,12 +383,13 @@ void StringArray::insert(int i, const char * text)
 ////////////////////////////////////////////////////////////////////////
 
 
-bool StringArray::has(const std::string text, bool forward) const
+bool StringArray::has(const std::string & text, bool forward) const
 
 {
 
   int index;
 
+
   return ( has(text, index, forward) );
 
 }
@@ -366,76 +398,144 @@ bool StringArray::has(const std::string text, bool forward) const
 ////////////////////////////////////////////////////////////////////////
 
 
-bool StringArray::has(const std::string text, int & index, bool forward) const
+bool StringArray::has(const std::string & text, int & index, bool forward) const
 
 {
-  bool found = false;
+  int j;
   index = -1;
 
-  if (!s.empty()) {
-    int count;
-    std::string lower_text = text;
-    std::vector<std::string>::const_iterator it;
-    if ( IgnoreCase ) transform(lower_text.begin(), lower_text.end(), lower_text.begin(), ::tolower);
-    
-    if (forward) {
-      count = 0;
-      for(it = s.begin(); it != s.end(); it++, count++) {
-        if ( IgnoreCase ) {
-          std::string lower_s = *it;
-          transform(lower_s.begin(), lower_s.end(), lower_s.begin(), ::tolower);
-          if ( lower_s == lower_text) {
-            //      if ( strcasecmp((*it).c_str(), text.c_str()) ) {
-            found = true;
-            break;
-          }
-        }
-        else {
-          if ( *it == text ) {
-            found = true;
-            break;
-          }
-        }
+  if ( s.empty() )  return ( false );
+
+    //
+    //  use the index for large arrays, building it on first use
+    //
+
+  if ( n() >= stringarray_index_min ) {
+    int ready;
+
+#pragma omp atomic read seq_cst
+    ready = IndexReady;
+
+    if ( !ready )  build_index();
+
+    std::string key = text;
+    if ( IgnoreCase )  fold_case(key);
+
+    std::map< std::string, std::pair<int, int> >::const_iterator it =
+      Index.find(key);
+
+    if ( it == Index.end() )  return ( false );
+
+    index = ( forward ? it->second.first : it->second.second );
+
+    return ( true );
+  }
+
+    //
+    //  otherwise, check each element
+    //
+
+  if (forward) {
+    for(j=0; j<n(); j++) {
+      if ( IgnoreCase ? equal_fold(s[j], text) : s[j] == text ) {
+        index = j;
+        break;
       }
     }
-    else {
-      count = s.size() - 1;
-      it = s.end();
-      for(it--; it != s.begin(); it--, count--) {
-        if ( IgnoreCase ) {
-          std::string lower_s = *it;
-          transform(lower_s.begin(), lower_s.end(), lower_s.begin(), ::tolower);
-          if ( lower_s == lower_text) {
-            found = true;
-            break;
-          }
-        }
-        else {
-          if ( *it == text ) {
-            found = true;
-            break;
-          }
-        }
-      }
-      if (!found && it == s.begin()) {
-        if ( IgnoreCase ) {
-          std::string lower_s = *it;
-          transform(lower_s.begin(), lower_s.end(), lower_s.begin(), ::tolower);
-          found = ( lower_s == lower_text );
-        }
-        else found = ( *it == text );
+  }
+  else {
+    for(j=n()-1; j>=0; j--) {
+      if ( IgnoreCase ? equal_fold(s[j], text) : s[j] == text ) {
+        index = j;
+        break;
       }
     }
-    if (found) index = count;
   }
-  //mlog << Debug(9) << " StringArray::has() size=" << s.size()
-  //     << " for " << text << ", found: " << (found ? "true" : "false")
-  //     << ", forward: " << (forward ? "yes" : "no") << "\n";
 
-  return found;
+  return ( index >= 0 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void StringArray::build_index() const
+
+{
+
+   //
+   //  const arrays may be searched by several threads at once,
+   //  so only one of them builds the index
+   //
+
+#pragma omp critical(met_string_array_index)
+{
+
+  if ( !IndexReady ) {
+
+    int j;
+
+    Index.clear();
+
+    for(j=0; j<n(); j++)  index_add(j);
+
+#pragma omp atomic write seq_cst
+    IndexReady = 1;
+
+  }
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void StringArray::index_add(int k) const
+
+{
+
+   //
+   //  positions are added in increasing order, so s[k] is the
+   //  last match for its key
+   //
+
+std::string key = s[k];
+
+if ( IgnoreCase )  fold_case(key);
+
+std::map< std::string, std::pair<int, int> >::iterator it = Index.find(key);
+
+if ( it != Index.end() )  it->second.second = k;
+else                      Index.insert(std::make_pair(key, std::make_pair(k, k)));
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void StringArray::reset_index()
+
+{
+
+if ( IndexReady == 0 && Index.empty() )  return;
+
+Index.clear();
+
+IndexReady = 0;
+
+return;
 
 }
 
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -486,6 +586,8 @@ void StringArray::parse_delim(const std::string text, const char *delim)
   if (start < str.length())
       s.push_back(str.substr(start).c_str());
 
+  reset_index();
+
   return;
 
 }
@@ -516,6 +618,8 @@ if ( (shift <= 0) || ((pos + shift) > n()) )  {
 
  s.erase(s.begin() + pos, s.begin() + pos + shift);
 
+ reset_index();
+
  return;
 
 }
@@ -606,7 +710,9 @@ void StringArray::sort()
 if ( n() <= 1 )  return;
 
  std::sort(s.begin(), s.end());
- 
+
+reset_index();
+
 return;
 
 }
@@ -697,6 +803,42 @@ return ( status );
 ////////////////////////////////////////////////////////////////////////
 
 
+void fold_case(std::string & text)
+
+{
+
+std::transform(text.begin(), text.end(), text.begin(), ::tolower);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool equal_fold(const std::string & a, const std::string & b)
+
+{
+
+if ( a.size() != b.size() )  return ( false );
+
+std::string::size_type j;
+
+for (j=0; j<a.size(); ++j)  {
+
+   if ( ::tolower(a[j]) != ::tolower(b[j]) )  return ( false );
+
+}
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 
 
 
@@ -20,7 +20,9 @@
 
 #include <iostream>
 #include <ostream>
+#include <string>
 #include <vector>
+#include <map>
 #include <algorithm>
 
 ////////////////////////////////////////////////////////////////////////
@@ -43,6 +45,22 @@ class StringArray {
 
       bool IgnoreCase;
 
+         //
+         //  index of the first and last positions of the distinct
+         //  (case-folded) strings for has(), built on first use, kept
+         //  up to date by add(), and discarded by the other modifiers
+         //
+
+      void build_index() const;
+
+      void index_add(int) const;
+
+      void reset_index();
+
+      mutable std::map< std::string, std::pair<int, int> > Index;
+
+      mutable int IndexReady;
+
 
    public:
 
@@ -77,9 +95,9 @@ class StringArray {
 
       int length(int) const;
 
-      bool has(const std::string, bool forward=true) const;
+      bool has(const std::string &, bool forward=true) const;
 
-      bool has(const std::string, int & index, bool forward=true) const;
+      bool has(const std::string &, int & index, bool forward=true) const;
 
          //
          //  parse delimited strings
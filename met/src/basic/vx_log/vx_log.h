@@ -24,6 +24,7 @@ using namespace std;
 #include "string_array.h"
 #include "file_fxns.h"
 #include "logger.h"
+#include "perf_timer.h"
 
 
 ////////////////////////////////////////////////////////////////////////
@@ -839,6 +839,20 @@ return;
 ////////////////////////////////////////////////////////////////////////
 
 
+void LineDataFile::set_line_file(DataLine & a)
+
+{
+
+a.File = this;
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 int LineDataFile::read_fwf_line(DataLine & a, const int *wdth, int n_wdth)
 
 {
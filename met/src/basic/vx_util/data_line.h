@@ -173,6 +173,8 @@ class LineDataFile {
 
       void set_header(DataLine &);
 
+      void set_line_file(DataLine &);   //  point the line back at this file
+
    public:
 
       LineDataFile();
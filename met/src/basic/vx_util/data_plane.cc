@@ -21,12 +21,15 @@
 
 using namespace std;
 
+#include <string.h>
+
 #include "data_plane.h"
 
 #include "vx_log.h"
 #include "vx_math.h"
 #include "vx_cal.h"
 #include "math_constants.h"
+#include "util_constants.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 //
@@ -53,6 +56,9 @@ DataPlane::DataPlane(const DataPlane &d) {
 
    init_from_scratch();
 
+   Storage    = d.Storage;
+   ScratchDir = d.ScratchDir;
+
    assign(d);
 }
 
@@ -71,6 +77,9 @@ DataPlane & DataPlane::operator=(const DataPlane &d) {
 
 void DataPlane::init_from_scratch() {
 
+   Storage = DataPlaneStorage_Double;
+   FBuf = (float *) 0;
+
    Nx = 0;
    Ny = 0;
    Nxy = 0;
@@ -86,7 +95,13 @@ void DataPlane::assign(const DataPlane &d) {
 
    set_size(d.nx(), d.ny());
 
-   Data = d.Data;
+      //
+      //  values are converted to the storage type of this plane
+      //
+
+   if ( !FBuf && !d.FBuf )     Data = d.Data;
+   else if ( FBuf && d.FBuf )  memcpy(FBuf, d.FBuf, Nxy*sizeof(float));
+   else                        for(int j=0; j<Nxy; ++j) set_n(j, d.get_n(j));
 
    InitTime  = d.init();
    ValidTime = d.valid();
@@ -102,6 +117,9 @@ void DataPlane::clear() {
 
    Data.clear();
 
+   FData.clear();
+   FBuf = (float *) 0;
+
    Nx = 0;
    Ny = 0;
 
@@ -117,8 +135,8 @@ void DataPlane::clear() {
 
 void DataPlane::erase() {
 
-   Data.resize(Nxy);
-   Data.assign(Nxy, 0);
+   if ( FBuf ) for(int j=0; j<Nxy; ++j) FBuf[j] = 0.0f;
+   else        alloc(0.0);
 
    InitTime = ValidTime = (unixtime) 0;
    LeadTime = AccumTime = 0;
@@ -137,6 +155,9 @@ void DataPlane::dump(ostream & out, int depth) const {
    out << prefix << "Nx        = " << Nx  << '\n';
    out << prefix << "Ny        = " << Ny  << '\n';
    out << prefix << "Nxy       = " << Nxy << '\n';
+   out << prefix << "Storage   = " << (is_float() ? "float" : "double")
+                 << (Storage == DataPlaneStorage_Mapped ? " (mapped)" : "")
+                 << '\n';
 
    time_str = unix_to_yyyymmdd_hhmmss(InitTime);
    out << prefix << "InitTime  = " << time_str << " (" << InitTime  << ")\n";
@@ -185,20 +206,99 @@ void DataPlane::set_size(int nx, int ny, double v) {
       //  resize and initialize data
       //
 
-   Data.resize(Nxy);
-   Data.assign(Nxy, v);
+   alloc(v);
 
    return;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void DataPlane::alloc(double v) {
+
+   if ( Storage == DataPlaneStorage_Double ) {
+
+      FData.clear();
+      FBuf = (float *) 0;
+
+      Data.resize(Nxy);
+      Data.assign(Nxy, v);
+
+      return;
+   }
+
+      //
+      //  release any double precision storage
+      //
+
+   std::vector<double>().swap(Data);
+
+   FData.clear();
+   FBuf = (float *) 0;
+
+   if ( Nxy == 0 )  return;
+
+   const bigint n_bytes = (bigint) Nxy * (bigint) sizeof(float);
+
+   if ( Storage == DataPlaneStorage_Mapped )  FData.allocate(n_bytes, ScratchDir.c_str());
+   else                                       FData.allocate(n_bytes);
+
+   FBuf = (float *) FData.buf();
+
+   for(int j=0; j<Nxy; ++j) FBuf[j] = (float) v;
+
+   return;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void DataPlane::set_storage(DataPlaneStorage s, const char *scratch_dir) {
+   ConcatString dir;
+
+   if ( s == DataPlaneStorage_Mapped )  {
+      dir = (scratch_dir ? scratch_dir : default_tmp_dir);
+   }
+
+   if ( s == Storage && dir == ScratchDir )  return;
+
+      //
+      //  convert the existing values to the new storage type
+      //
+
+   DataPlane tmp(*this);
+
+   Storage    = s;
+   ScratchDir = dir;
+
+   assign(tmp);
+
+   return;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void DataPlane::storage_error(const char *method) const {
+
+   if ( is_float() ) {
+      mlog << Error << "\nDataPlane::" << method << " -> "
+           << "double precision access to a single precision data plane! "
+           << "Call set_storage(DataPlaneStorage_Double) first.\n\n";
+   }
+   else {
+      mlog << Error << "\nDataPlane::" << method << " -> "
+           << "single precision access to a double precision data plane!\n\n";
+   }
+
+   exit(1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void DataPlane::set(double v, int x, int y) {
    int n;
 
    n = two_to_one(x, y);
 
-   Data[n] = v;
+   set_n(n, v);
 
    return;
 }
@@ -225,7 +325,7 @@ void DataPlane::set_block(double *v, int nx, int ny) {
    for (int y=0; y < ny; y++) {
       int dp_offset = two_to_one(0, y);
       for (int x=0; x < nx; x++) {
-         Data[dp_offset+x] = v[offset++];
+         set_n(dp_offset+x, v[offset++]);
       }
    }
    
@@ -234,15 +334,46 @@ void DataPlane::set_block(double *v, int nx, int ny) {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void DataPlane::set_block(const float *v, int nx, int ny) {
+   const char *method_name = "DataPlane::set_block() -> ";
+
+   if (nx > Nx) {
+      mlog << Error << "\n" << method_name << "nx is too big ("
+           << nx << " should be equal or less than " << Nx << "\n\n\n";
+      exit(1);
+   }
+   if (ny > Ny) {
+      mlog << Error << "\n" << method_name << "ny is too big ("
+           << ny << " should be equal or less than " << Ny << "\n\n\n";
+      exit(1);
+   }
+
+   int offset = 0;
+   for (int y=0; y < ny; y++) {
+      int dp_offset = two_to_one(0, y);
+      if (FBuf) {
+         memcpy(FBuf + dp_offset, v + offset, nx*sizeof(float));
+         offset += nx;
+      }
+      else {
+         for (int x=0; x < nx; x++) Data[dp_offset+x] = v[offset++];
+      }
+   }
+
+   return;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void DataPlane::set_constant(double v) {
 
-   if(Data.empty()) {
+   if(Nxy == 0) {
       mlog << Error << "\nDataPlane::set_constant(double) -> "
            << "no data buffer allocated!\n\n";
       exit(1);
    }
 
-   Data.assign(Nxy, v);
+   for(int j=0; j<Nxy; ++j) set_n(j, v);
 
    return;
 }
@@ -286,7 +417,7 @@ bool DataPlane::is_all_bad_data() const {
    //
 
    for(j=0; j<Nxy; ++j) {
-      if( !is_bad_data(Data[j]) ) {
+      if( !is_bad_data(get_n(j)) ) {
          status = false;
          break;
       }
@@ -297,16 +428,6 @@ bool DataPlane::is_all_bad_data() const {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-double DataPlane::get(int x, int y) const {
-   int n;
-
-   n = two_to_one(x, y);
-
-   return(Data[n]);
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
 void DataPlane::threshold(const SingleThresh &st) {
    int j;
 
@@ -318,9 +439,9 @@ void DataPlane::threshold(const SingleThresh &st) {
 
    for(j=0; j<Nxy; ++j) {
 
-      if( is_bad_data(Data[j]) )  continue;
-      if( st.check(Data[j]) )     Data[j] = 1.0;
-      else                        Data[j] = 0.0;
+      if( is_bad_data(get_n(j)) )  continue;
+      if( st.check(get_n(j)) )     set_n(j, 1.0);
+      else                         set_n(j, 0.0);
 
    }
 
@@ -336,7 +457,7 @@ void DataPlane::convert(const UserFunc_1Arg &convert_fx) {
    mlog << Debug(3) << "Applying conversion function.\n";
 
    for(int i=0; i<Nxy; i++) {
-      if(!is_bad_data(buf()[i])) buf()[i] = convert_fx(buf()[i]);
+      if(!is_bad_data(get_n(i))) set_n(i, convert_fx(get_n(i)));
    }
 
    return;
@@ -357,7 +478,7 @@ void DataPlane::censor(const ThreshArray &censor_thresh,
       NumArray d;
       d.extend(Nxy);
       for(i=0; i<Nxy; i++) {
-         if(!is_bad_data(Data[i])) d.add(Data[i]);
+         if(!is_bad_data(get_n(i))) d.add(get_n(i));
       }
       ta.set_perc(&d, &d, &d);
    }
@@ -373,8 +494,8 @@ void DataPlane::censor(const ThreshArray &censor_thresh,
       for(j=0; j<ta.n_elements(); j++) {
 
          // Break out after the first match.
-         if(ta[j].check(Data[i])) {
-            Data[i] = censor_val[j];
+         if(ta[j].check(get_n(i))) {
+            set_n(i, censor_val[j]);
             count++;
             break;
          }
@@ -399,7 +520,7 @@ int j;
 
 for (j=0; j<Nxy; ++j)  {
 
-   if ( is_bad_data(Data[j]) )  Data[j] = value;
+   if ( is_bad_data(get_n(j)) )  set_n(j, value);
 
 }
 
@@ -410,19 +531,13 @@ return;
 
 ///////////////////////////////////////////////////////////////////////////////
 
-int DataPlane::two_to_one(int x, int y, bool to_north) const {
-   int n;
-
-   if((x < 0) || (x >= Nx) || (y < 0) || (y >= Ny)) {
-      mlog << Error << "\nDataPlane::two_to_one() -> "
-           << "range check error: (Nx, Ny) = (" << Nx << ", " << Ny
-           << "), (x, y) = (" << x << ", " << y << ")\n\n";
-      exit(1);
-   }
+void DataPlane::range_error(int x, int y) const {
 
-   n = (to_north ? y : (Ny-1-y))*Nx + x;    //  don't change this!  lots of downstream code depends on this!
+   mlog << Error << "\nDataPlane::two_to_one() -> "
+        << "range check error: (Nx, Ny) = (" << Nx << ", " << Ny
+        << "), (x, y) = (" << x << ", " << y << ")\n\n";
 
-   return(n);
+   exit(1);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -484,7 +599,7 @@ void DataPlane::data_range(double & data_min, double & data_max) const {
 
    for(j=0; j<Nxy; ++j) {
 
-      value = Data[j];
+      value = get_n(j);
 
       if(is_bad_data(value)) continue;
 
@@ -513,7 +628,7 @@ MaskPlane DataPlane::mask_plane() const {
    mp.set_size(Nx, Ny);
 
    for(int i=0; i<Nxy; i++) {
-      mp.buf()[i] = (is_bad_data(Data[i]) ? false : !is_eq(Data[i], 0.0));
+      mp.buf()[i] = (is_bad_data(get_n(i)) ? false : !is_eq(get_n(i), 0.0));
    }
 
    return(mp);
@@ -534,7 +649,7 @@ void DataPlane::shift_right(int N)
    //
 
 
-if ( Data.empty() )  {
+if ( Nxy == 0 )  {
 
    mlog << Error
         << "\n\n  DataPlane::shift_right(int) -> data plane is empty!\n\n";
@@ -566,13 +681,13 @@ for (x=0; x<Nx; ++x)  {
       index_old = two_to_one(x,     y);
       index_new = two_to_one(x_new, y);
 
-      new_data[index_new] = Data[index_old];
+      new_data[index_new] = get_n(index_old);
 
    }
 
 }
 
-Data = new_data;
+for (x=0; x<Nxy; ++x)  set_n(x, new_data[x]);
 
    //
    //  done
@@ -590,7 +705,7 @@ void DataPlane::put(const double value, const int x, const int y)
 
 {
 
-if ( Data.empty() )  {
+if ( Nxy == 0 )  {
 
    mlog << Error
         << "\n\n  DataPlane::put() -> no data plane allocated!\n\n";
@@ -601,7 +716,7 @@ if ( Data.empty() )  {
 
 const int n = two_to_one(x, y);   //  the two_to_one function does range checking on x and y
 
-Data[n] = value;
+set_n(n, value);
 
 return;
 
@@ -631,7 +746,7 @@ const unsigned int mnw = (Nx + 1)/2;
    //
 
 for (j=0; j<Nxy; ++j)  {
-   if (is_bad_data(Data[j])) return ( false );
+   if (is_bad_data(get_n(j))) return ( false );
 }
 
    //
@@ -757,7 +872,7 @@ const int unsigned mnw = (Nx + 1)/2;
    //
 
 for (i=0; i<Nxy; ++i)  {
-   if (is_bad_data(Data[i])) return ( false );
+   if (is_bad_data(get_n(i))) return ( false );
 }
 
    //
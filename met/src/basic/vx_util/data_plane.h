@@ -21,6 +21,7 @@
 #include "num_array.h"
 #include "two_d_array.h"
 #include "config_funcs.h"
+#include "mapped_buffer.h"
 
 #include "vx_cal.h"
 
@@ -28,6 +29,22 @@
 
 typedef TwoD_Array<bool> MaskPlane;
 
+////////////////////////////////////////////////////////////////////////
+
+   //
+   //  Storage used for the values of a DataPlane.  The single precision
+   //  storage types halve the memory footprint of large planes at the
+   //  cost of the double pointer access through data() and buf().
+   //
+
+enum DataPlaneStorage {
+
+   DataPlaneStorage_Double = 0,   //  double precision in memory (default)
+   DataPlaneStorage_Float,        //  single precision in memory
+   DataPlaneStorage_Mapped        //  single precision in a memory-mapped scratch file
+
+};
+
 ////////////////////////////////////////////////////////////////////////
 
 class DataPlane {
@@ -41,6 +58,24 @@ class DataPlane {
 
       std::vector<double> Data;
 
+      DataPlaneStorage Storage;
+
+      ConcatString ScratchDir;   //  for DataPlaneStorage_Mapped
+
+      MappedBuffer FData;        //  single precision storage
+
+      float * FBuf;              //  points into FData, not allocated
+
+      void alloc(double);
+
+      double get_n(int) const;
+      void   set_n(int, double);
+
+         //  error exits kept out of the inline accessors
+
+      void storage_error(const char *) const;
+      void range_error(int x, int y) const;
+
       int Nx;
       int Ny;
 
@@ -68,10 +103,16 @@ class DataPlane {
          // Set functions
          //
 
+         //  Storage is kept by clear(), set_size(), and assignment,
+         //  so it may be set before a plane is read or copied into
+
+      void set_storage(DataPlaneStorage, const char *scratch_dir = 0);
+
       void set_size(int nx, int ny, double v = 0.0);
 
       void set(double, int, int);   //  x, y
       void set_block(double *, int, int);   //  nx, ny
+      void set_block(const float *, int, int);   //  nx, ny
 
       void set_constant(double);
 
@@ -96,9 +137,21 @@ class DataPlane {
       double   get(int x, int y) const;
       double   operator () (int x, int y) const;
 
+      DataPlaneStorage storage() const;
+      bool     is_float() const;
+
+         //  Double precision access is only available for
+         //  DataPlaneStorage_Double
+
       const double * data() const;
       std::vector<double> & buf();
 
+         //  Single precision access is only available for
+         //  DataPlaneStorage_Float and DataPlaneStorage_Mapped
+
+      const float * fdata() const;
+      float * fbuf();
+
          //
          // Do stuff
          //
@@ -142,8 +195,24 @@ inline int      DataPlane::accum() const { return (AccumTime); }
 
 inline double DataPlane::operator()(int x, int y) const { return(get(x, y)); }
 
-inline const double * DataPlane::data() const { return ( Data.data() ); }
-inline std::vector<double> & DataPlane::buf() { return ( Data ); }
+inline DataPlaneStorage DataPlane::storage() const { return (Storage); }
+inline bool DataPlane::is_float() const { return (Storage != DataPlaneStorage_Double); }
+
+inline double DataPlane::get_n(int n) const { return ( FBuf ? (double) FBuf[n] : Data[n] ); }
+inline void DataPlane::set_n(int n, double v) { if ( FBuf ) FBuf[n] = (float) v; else Data[n] = v; }
+
+inline const double * DataPlane::data() const { if ( is_float() ) storage_error("data()"); return ( Data.data() ); }
+inline std::vector<double> & DataPlane::buf() { if ( is_float() ) storage_error("buf()"); return ( Data ); }
+
+inline const float * DataPlane::fdata() const { if ( !is_float() ) storage_error("fdata()"); return ( FBuf ); }
+inline float * DataPlane::fbuf() { if ( !is_float() ) storage_error("fbuf()"); return ( FBuf ); }
+
+inline double DataPlane::get(int x, int y) const { return ( get_n(two_to_one(x, y)) ); }
+
+inline int DataPlane::two_to_one(int x, int y, bool to_north) const {
+   if ( (x < 0) || (x >= Nx) || (y < 0) || (y >= Ny) ) range_error(x, y);
+   return ( (to_north ? y : (Ny-1-y))*Nx + x );   //  don't change this!  lots of downstream code depends on this!
+}
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -11,10 +11,13 @@
 using namespace std;
 
 #include <cstdlib>
+#include <deque>
 #include <iostream>
 #include <math.h>
+#include <set>
 #include <string.h>
 #include <unistd.h>
+#include <vector>
 
 #include "data_plane_util.h"
 #include "interp_util.h"
@@ -33,6 +36,21 @@ using namespace std;
 //
 ////////////////////////////////////////////////////////////////////////
 
+static void smooth_field_square(const DataPlane &, DataPlane &,
+                                InterpMthd, int width, double t);
+
+static void sliding_sum(const double *, int n, int stride,
+                        int lo, int hi, double *);
+static void sliding_min_max(const double *, int n, int stride,
+                            int lo, int hi, bool is_min, double *);
+
+static void box_sum(const vector<double> &, int nx, int ny,
+                    int lo, int hi, vector<double> &);
+static void box_min_max(const vector<double> &, int nx, int ny,
+                        int lo, int hi, bool is_min, vector<double> &);
+static void box_median(const vector<double> &, const vector<bool> &,
+                       int nx, int ny, int lo, int hi, vector<double> &);
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Check the range of probability values and make sure it's either
@@ -114,55 +132,66 @@ void smooth_field(const DataPlane &dp, DataPlane &smooth_dp,
         << "(" << gt->size() << ") " << gt->getClassName()
         << " interpolation method.\n";
 
+   // Square neighborhoods use sliding windows rather than
+   // searching the full neighborhood of each grid point
+   if(shape == GridTemplateFactory::GridTemplate_Square &&
+      (mthd == InterpMthd_Min    || mthd == InterpMthd_Max     ||
+       mthd == InterpMthd_Median || mthd == InterpMthd_UW_Mean ||
+       mthd == InterpMthd_MaxGauss)) {
+      smooth_field_square(dp, smooth_dp, mthd, width,
+                          (mthd == InterpMthd_MaxGauss ? 0.0 : t));
+   }
    // Otherwise, apply smoothing to each grid point
-   for(x=0; x<dp.nx(); x++) {
-      for(y=0; y<dp.ny(); y++) {
+   else {
+      for(x=0; x<dp.nx(); x++) {
+         for(y=0; y<dp.ny(); y++) {
 
-         // Compute the smoothed value based on the interpolation method
-         switch(mthd) {
+            // Compute the smoothed value based on the interpolation method
+            switch(mthd) {
 
-            case(InterpMthd_Min):      // Minimum
-               v = interp_min(dp, *gt, x, y, t);
-               break;
+               case(InterpMthd_Min):      // Minimum
+                  v = interp_min(dp, *gt, x, y, t);
+                  break;
 
-            case(InterpMthd_Max):      // Maximum
-               v = interp_max(dp, *gt, x, y, t);
-               break;
+               case(InterpMthd_Max):      // Maximum
+                  v = interp_max(dp, *gt, x, y, t);
+                  break;
 
-            case(InterpMthd_Median):   // Median
-               v = interp_median(dp, *gt, x, y, t);
-               break;
+               case(InterpMthd_Median):   // Median
+                  v = interp_median(dp, *gt, x, y, t);
+                  break;
 
-            case(InterpMthd_UW_Mean):  // Unweighted Mean
-               v = interp_uw_mean(dp, *gt, x, y, t);
-               break;
+               case(InterpMthd_UW_Mean):  // Unweighted Mean
+                  v = interp_uw_mean(dp, *gt, x, y, t);
+                  break;
 
-            case(InterpMthd_Gaussian): // For Gaussian, pass the data through
-               v = dp.get(x, y);
-               break;
+               case(InterpMthd_Gaussian): // For Gaussian, pass the data through
+                  v = dp.get(x, y);
+                  break;
 
-            case(InterpMthd_MaxGauss): // For Max Gaussian, compute the max
-               v = interp_max(dp, *gt, x, y, 0);
-               break;
+               case(InterpMthd_MaxGauss): // For Max Gaussian, compute the max
+                  v = interp_max(dp, *gt, x, y, 0);
+                  break;
 
-            // Distance-weighted mean, area-weighted mean, least-squares
-            // fit, and bilinear are omitted here since they are not
-            // options for gridded data.
+               // Distance-weighted mean, area-weighted mean, least-squares
+               // fit, and bilinear are omitted here since they are not
+               // options for gridded data.
 
-            default:
-               mlog << Error << "\nsmooth_field() -> "
-                    << "unsupported interpolation method encountered: "
-                    << interpmthd_to_string(mthd) << "(" << mthd
-                    << ")\n\n";
-               exit(1);
-               break;
-         }
+               default:
+                  mlog << Error << "\nsmooth_field() -> "
+                       << "unsupported interpolation method encountered: "
+                       << interpmthd_to_string(mthd) << "(" << mthd
+                       << ")\n\n";
+                  exit(1);
+                  break;
+            }
 
-         // Store the smoothed value
-         smooth_dp.set(v, x, y);
+            // Store the smoothed value
+            smooth_dp.set(v, x, y);
 
-      } // end for y
-   } // end for x
+         } // end for y
+      } // end for x
+   }
 
    // Apply the Gaussian smoother 
    if(mthd == InterpMthd_Gaussian ||
@@ -176,6 +205,319 @@ void smooth_field(const DataPlane &dp, DataPlane &smooth_dp,
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Smooth the DataPlane values over a square neighborhood of the given
+// width with sliding windows, so the cost doesn't depend on the width
+// for the min, max, and mean.  Like the square GridTemplate, the
+// neighborhood extends width/2 points right and up from each point and
+// the rest left and down.  The bad data and valid data threshold logic
+// matches interp_min(), interp_max(), interp_median(), and
+// interp_uw_mean().
+//
+////////////////////////////////////////////////////////////////////////
+
+void smooth_field_square(const DataPlane &dp, DataPlane &smooth_dp,
+                         InterpMthd mthd, int width, double t) {
+   int i, x, y;
+   const int nx = dp.nx();
+   const int ny = dp.ny();
+   const int hi = width/2;
+   const int lo = width - 1 - hi;
+   const int num_points = width*width;
+   double v;
+
+   // Store the data, the valid data mask, and each valid value or zero
+   vector<double> in(nx*ny), in_zero(nx*ny), in_vld(nx*ny);
+   vector<bool> vld(nx*ny);
+   vector<double> n_vld, n_nonzero, out;
+
+   for(y=0; y<ny; y++) {
+      for(x=0; x<nx; x++) {
+         i          = y*nx + x;
+         in[i]      = dp.get(x, y);
+         vld[i]     = !is_bad_data(in[i]);
+         in_zero[i] = (vld[i] ? in[i] : 0.0);
+         in_vld[i]  = (vld[i] ? 1.0   : 0.0);
+      }
+   }
+
+   // Number of valid points in each neighborhood
+   box_sum(in_vld, nx, ny, lo, hi, n_vld);
+
+   switch(mthd) {
+
+      case(InterpMthd_Min):
+         for(i=0; i<nx*ny; i++) if(!vld[i]) in[i] =  HUGE_VAL;
+         box_min_max(in, nx, ny, lo, hi, true, out);
+         break;
+
+      case(InterpMthd_Max):
+      case(InterpMthd_MaxGauss):
+         for(i=0; i<nx*ny; i++) if(!vld[i]) in[i] = -HUGE_VAL;
+         box_min_max(in, nx, ny, lo, hi, false, out);
+         break;
+
+      case(InterpMthd_UW_Mean):
+         box_sum(in_zero, nx, ny, lo, hi, out);
+
+         // Count the nonzero valid values in each neighborhood, which
+         // is exact since the counts are small integers
+         for(i=0; i<nx*ny; i++) in_vld[i] = (in_zero[i] != 0.0 ? 1.0 : 0.0);
+         box_sum(in_vld, nx, ny, lo, hi, n_nonzero);
+
+         for(i=0; i<nx*ny; i++) {
+            // Discard any round off left by values which have left the
+            // window, so that neighborhoods of zeros have a mean of 0
+            if(nint(n_nonzero[i]) == 0) out[i] = 0.0;
+            out[i] /= nint(n_vld[i]);
+         }
+         break;
+
+      case(InterpMthd_Median):
+         box_median(in, vld, nx, ny, lo, hi, out);
+         break;
+
+      default:
+         mlog << Error << "\nsmooth_field_square() -> "
+              << "unsupported interpolation method encountered: "
+              << interpmthd_to_string(mthd) << "(" << mthd
+              << ")\n\n";
+         exit(1);
+         break;
+   }
+
+   // Check whether enough valid grid points were found
+   for(y=0; y<ny; y++) {
+      for(x=0; x<nx; x++) {
+         i = y*nx + x;
+         v = out[i];
+         if(nint(n_vld[i]) == 0 && mthd != InterpMthd_UW_Mean) {
+            v = bad_data_double;
+         }
+         if((static_cast<double>(nint(n_vld[i])) / num_points) < t) {
+            v = bad_data_double;
+         }
+         smooth_dp.set(v, x, y);
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Sum of the n values spaced stride apart over the window extending
+// lo points before and hi points after each one.  The running sum is
+// compensated (Neumaier) so that the round off from values leaving the
+// window does not accumulate along the row or column.
+//
+////////////////////////////////////////////////////////////////////////
+
+static void add_compensated(double v, double &sum, double &c) {
+   double t = sum + v;
+
+   if(fabs(sum) >= fabs(v)) c += (sum - t) + v;
+   else                     c += (v - t) + sum;
+
+   sum = t;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void sliding_sum(const double *in, int n, int stride,
+                 int lo, int hi, double *out) {
+   int i;
+   double sum = 0.0, c = 0.0;
+
+   for(i=0; i<=hi && i<n; i++) add_compensated(in[i*stride], sum, c);
+
+   for(i=0; i<n; i++) {
+      out[i*stride] = sum + c;
+      if(i+1+hi <  n) add_compensated( in[(i+1+hi)*stride], sum, c);
+      if(i-lo   >= 0) add_compensated(-in[(i-lo)*stride],   sum, c);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Minimum or maximum of the n values spaced stride apart over the
+// window extending lo points before and hi points after each one,
+// using a deque of the indices of the candidate values.
+//
+////////////////////////////////////////////////////////////////////////
+
+void sliding_min_max(const double *in, int n, int stride,
+                     int lo, int hi, bool is_min, double *out) {
+   int i, j;
+   double v;
+   deque<int> dq;
+
+   for(i=0, j=0; i<n; i++) {
+
+      // Add the values entering the window
+      for(; j<=i+hi && j<n; j++) {
+         v = in[j*stride];
+         while(!dq.empty() &&
+               ( is_min ? in[dq.back()*stride] >= v
+                        : in[dq.back()*stride] <= v)) dq.pop_back();
+         dq.push_back(j);
+      }
+
+      // Drop the values leaving the window
+      while(dq.front() < i-lo) dq.pop_front();
+
+      out[i*stride] = in[dq.front()*stride];
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void box_sum(const vector<double> &in, int nx, int ny,
+             int lo, int hi, vector<double> &out) {
+   int x, y;
+   vector<double> row_sum(nx*ny);
+
+   out.resize(nx*ny);
+
+#pragma omp parallel for schedule(static)
+   for(y=0; y<ny; y++) {
+      sliding_sum(&in[y*nx], nx, 1, lo, hi, &row_sum[y*nx]);
+   }
+
+#pragma omp parallel for schedule(static)
+   for(x=0; x<nx; x++) {
+      sliding_sum(&row_sum[x], ny, nx, lo, hi, &out[x]);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void box_min_max(const vector<double> &in, int nx, int ny,
+                 int lo, int hi, bool is_min, vector<double> &out) {
+   int x, y;
+   vector<double> row_ext(nx*ny);
+
+   out.resize(nx*ny);
+
+#pragma omp parallel for schedule(static)
+   for(y=0; y<ny; y++) {
+      sliding_min_max(&in[y*nx], nx, 1, lo, hi, is_min, &row_ext[y*nx]);
+   }
+
+#pragma omp parallel for schedule(static)
+   for(x=0; x<nx; x++) {
+      sliding_min_max(&row_ext[x], ny, nx, lo, hi, is_min, &out[x]);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Median of the valid values in each neighborhood.  The window slides
+// along each row, keeping the lower half of its sorted values in one
+// set and the upper half in the other, so only the columns entering
+// and leaving the window are added and removed.
+//
+////////////////////////////////////////////////////////////////////////
+
+static void median_insert(multiset<double> &low, multiset<double> &upp,
+                          double v) {
+   if(!upp.empty() && v >= *upp.begin()) upp.insert(v);
+   else                                   low.insert(v);
+   return;
+}
+
+static void median_erase(multiset<double> &low, multiset<double> &upp,
+                         double v) {
+   if(!low.empty() && v <= *low.rbegin()) low.erase(low.find(v));
+   else                                   upp.erase(upp.find(v));
+   return;
+}
+
+static void median_balance(multiset<double> &low, multiset<double> &upp) {
+   const int n = (int) (low.size() + upp.size());
+
+   // Store (n+1)/2 values in the lower half
+   while((int) low.size() > (n+1)/2) {
+      upp.insert(*low.rbegin());
+      low.erase(--low.end());
+   }
+   while((int) low.size() < (n+1)/2) {
+      low.insert(*upp.begin());
+      upp.erase(upp.begin());
+   }
+
+   return;
+}
+
+void box_median(const vector<double> &in, const vector<bool> &vld,
+                int nx, int ny, int lo, int hi, vector<double> &out) {
+   int y;
+
+   out.resize(nx*ny);
+
+#pragma omp parallel for schedule(dynamic)
+   for(y=0; y<ny; y++) {
+
+      multiset<double> low, upp;
+      const int y_beg = max(y-lo, 0);
+      const int y_end = min(y+hi, ny-1);
+      int i, j, x, xx, yy, n, index;
+      double delta, v_low, v_upp;
+
+      // Columns in the window for the first point of the row
+      for(xx=0; xx<=hi && xx<nx; xx++) {
+         for(yy=y_beg; yy<=y_end; yy++) {
+            j = yy*nx + xx;
+            if(vld[j]) median_insert(low, upp, in[j]);
+         }
+      }
+      median_balance(low, upp);
+
+      for(x=0; x<nx; x++) {
+
+         // Same as percentile() at 0.50 of the sorted values
+         i = y*nx + x;
+         n = (int) (low.size() + upp.size());
+         if(n == 0) {
+            out[i] = bad_data_double;
+         }
+         else {
+            index  = (n-1)/2;
+            delta  = (n-1)*0.50 - index;
+            v_low  = *low.rbegin();
+            v_upp  = (upp.empty() ? v_low : *upp.begin());
+            out[i] = (1 - delta)*v_low + delta*v_upp;
+         }
+
+         // Slide the window to the next point
+         for(yy=y_beg; yy<=y_end; yy++) {
+            if(x-lo >= 0) {
+               j = yy*nx + x-lo;
+               if(vld[j]) median_erase(low, upp, in[j]);
+            }
+            if(x+1+hi < nx) {
+               j = yy*nx + x+1+hi;
+               if(vld[j]) median_insert(low, upp, in[j]);
+            }
+         }
+         median_balance(low, upp);
+      }
+   }
+
+   return;
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Smooth the DataPlane values using the interpolation method and
@@ -201,32 +543,15 @@ DataPlane smooth_field(const DataPlane &dp,
 //
 ////////////////////////////////////////////////////////////////////////
 
-void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
-        int width, const GridTemplateFactory::GridTemplates shape,
-        SingleThresh t, double vld_t) {
+static void fractional_coverage_template(const DataPlane &dp,
+               DataPlane &frac_dp, const GridTemplate &gt,
+               const SingleThresh &t, double vld_t) {
    GridPoint *gp = NULL;
    int x, y;
    int n_vld = 0;
    int n_thr = 0;
    double v;
 
-   // Check that width is set to 1 or greater
-   if(width < 1) {
-      mlog << Error << "\nfractional_coverage() -> "
-           << "Grid must have at least one point in it. \n\n";
-      exit(1);
-   }
-
-   // Build the grid template
-   GridTemplateFactory gtf;
-   GridTemplate* gt = gtf.buildGT(shape, width);
-
-   mlog << Debug(3)
-        << "Computing fractional coverage field using the "
-        << t.get_str() << " threshold and the "
-        << interpmthd_to_string(InterpMthd_Nbrhd) << "(" << gt->size()
-        << ") " << gt->getClassName() << " interpolation method.\n";
-
    // Initialize the fractional coverage field
    frac_dp = dp;
    frac_dp.set_constant(bad_data_double);
@@ -242,9 +567,9 @@ void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
             n_vld = n_thr = 0;
 
             // Sum all the points
-            for(gp  = gt->getFirstInGrid(x, y, dp.nx(), dp.ny());
+            for(gp  = gt.getFirstInGrid(x, y, dp.nx(), dp.ny());
                 gp != NULL;
-                gp  = gt->getNextInGrid()) {
+                gp  = gt.getNextInGrid()) {
                if(is_bad_data(v = dp.get(gp->x, gp->y))) continue;
                n_vld++;
                if(t.check(v)) n_thr++;
@@ -254,21 +579,21 @@ void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
          else {
 
             // Subtract points from the the bottom edge
-            for(gp  = gt->getFirstInBotEdge();
+            for(gp  = gt.getFirstInBotEdge();
                 gp != NULL;
-                gp  = gt->getNextInBotEdge()) {
+                gp  = gt.getNextInBotEdge()) {
                if(is_bad_data(v = dp.get(gp->x, gp->y))) continue;
                n_vld--;
                if(t.check(v)) n_thr--;
             }
 
             // Increment Y
-            gt->incBaseY(1);
+            gt.incBaseY(1);
 
             // Add points from the the top edge
-            for(gp  = gt->getFirstInTopEdge();
+            for(gp  = gt.getFirstInTopEdge();
                 gp != NULL;
-                gp  = gt->getNextInTopEdge()) {
+                gp  = gt.getNextInTopEdge()) {
                if(is_bad_data(v = dp.get(gp->x, gp->y))) continue;
                n_vld++;
                if(t.check(v)) n_thr++;
@@ -276,17 +601,94 @@ void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
          }
 
          // Check for enough valid data and compute fractional coverage
-         if((double)(n_vld)/gt->size() >= vld_t && n_vld != 0) {
+         if((double)(n_vld)/gt.size() >= vld_t && n_vld != 0) {
             frac_dp.set((double) n_thr/n_vld, x, y);
          }
 
       } // end for y
 
       // Increment X
-      if(x < (dp.nx() - 1)) gt->incBaseX(1);
+      if(x < (dp.nx() - 1)) gt.incBaseX(1);
 
    } // end for x
 
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
+        int width, const GridTemplateFactory::GridTemplates shape,
+        SingleThresh t, double vld_t) {
+   NbrhdCountTable nct;
+
+   // Check that width is set to 1 or greater
+   if(width < 1) {
+      mlog << Error << "\nfractional_coverage() -> "
+           << "Grid must have at least one point in it. \n\n";
+      exit(1);
+   }
+
+   // Build the grid template
+   GridTemplateFactory gtf;
+   GridTemplate* gt = gtf.buildGT(shape, width);
+
+   mlog << Debug(3)
+        << "Computing fractional coverage field using the "
+        << t.get_str() << " threshold and the "
+        << interpmthd_to_string(InterpMthd_Nbrhd) << "(" << gt->size()
+        << ") " << gt->getClassName() << " interpolation method.\n";
+
+   // Initialize the fractional coverage field
+   frac_dp = dp;
+
+   // Use the count tables when the template rows are contiguous
+   nct.set(dp, t);
+   if(!nct.fractional_coverage(*gt, vld_t, frac_dp)) {
+      fractional_coverage_template(dp, frac_dp, *gt, t, vld_t);
+   }
+
+   delete gt;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Compute the fractional coverage from count tables that have already
+// been built, which may be reused across multiple neighborhood widths.
+//
+////////////////////////////////////////////////////////////////////////
+
+void fractional_coverage(const NbrhdCountTable &nct, DataPlane &frac_dp,
+        int width, const GridTemplateFactory::GridTemplates shape,
+        double vld_t) {
+
+   // Check that width is set to 1 or greater
+   if(width < 1) {
+      mlog << Error << "\nfractional_coverage() -> "
+           << "Grid must have at least one point in it. \n\n";
+      exit(1);
+   }
+
+   // Build the grid template
+   GridTemplateFactory gtf;
+   GridTemplate* gt = gtf.buildGT(shape, width);
+
+   mlog << Debug(3)
+        << "Computing fractional coverage field using the "
+        << nct.thresh().get_str() << " threshold and the "
+        << interpmthd_to_string(InterpMthd_Nbrhd) << "(" << gt->size()
+        << ") " << gt->getClassName() << " interpolation method.\n";
+
+   if(!nct.fractional_coverage(*gt, vld_t, frac_dp)) {
+      mlog << Error << "\nfractional_coverage() -> "
+           << "the " << gt->getClassName() << " of width " << width
+           << " cannot be computed from the neighborhood count "
+           << "tables.\n\n";
+      exit(1);
+   }
+
    delete gt;
 
    return;
@@ -29,6 +29,7 @@
 #include "interp_mthd.h"
 #include "num_array.h"
 #include "config_gaussian.h"
+#include "nbrhd_count_table.h"
 
 #include "GridTemplate.h"
 
@@ -54,6 +55,10 @@ extern void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
                int width, const GridTemplateFactory::GridTemplates shape,
                SingleThresh t, double vld_t);
 
+extern void fractional_coverage(const NbrhdCountTable &nct, DataPlane &frac_dp,
+               int width, const GridTemplateFactory::GridTemplates shape,
+               double vld_t);
+
 extern void fractional_coverage_square(const DataPlane &dp, DataPlane &frac_dp,
                int width, SingleThresh t, double vld_t);
 
@@ -0,0 +1,117 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <unistd.h>
+#include <stdlib.h>
+
+#ifdef _OPENMP
+   #include <omp.h>
+#endif
+
+#include "handle_openmp.h"
+
+#include "vx_log.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static const char omp_num_threads_env [] = "OMP_NUM_THREADS";
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void init_openmp()
+
+{
+
+#ifdef _OPENMP
+
+ConcatString cs;
+
+   //
+   //  run serially unless the user explicitly requests more threads
+   //
+
+if ( !get_env(omp_num_threads_env, cs) )  {
+
+   omp_set_num_threads(1);
+
+   mlog << Debug(2)
+        << "OpenMP running on 1 thread by default. Set the "
+        << omp_num_threads_env << " environment variable to use more.\n";
+
+} else {
+
+   mlog << Debug(2)
+        << "OpenMP running on " << omp_get_max_threads()
+        << " thread(s) as requested by " << omp_num_threads_env << " = "
+        << cs << ".\n";
+
+}
+
+#endif
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int met_num_threads()
+
+{
+
+#ifdef _OPENMP
+
+return ( omp_get_max_threads() );
+
+#else
+
+return ( 1 );
+
+#endif
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int met_thread_num()
+
+{
+
+#ifdef _OPENMP
+
+return ( omp_get_thread_num() );
+
+#else
+
+return ( 0 );
+
+#endif
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
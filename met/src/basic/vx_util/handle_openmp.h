@@ -0,0 +1,44 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifndef  __HANDLE_OPENMP_H__
+#define  __HANDLE_OPENMP_H__
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  OpenMP support is enabled at configure time with --enable-openmp.
+   //  The number of threads is set by the OMP_NUM_THREADS environment
+   //  variable and defaults to 1 when it is not set.  These functions
+   //  may be called whether or not OpenMP is enabled.
+   //
+
+extern void init_openmp();
+
+extern int  met_num_threads();   //  threads available to parallel regions
+
+extern int  met_thread_num();    //  index of the calling thread
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#endif   /*  __HANDLE_OPENMP_H__  */
+
+
+////////////////////////////////////////////////////////////////////////
+
+
@@ -564,18 +564,17 @@ void interp_gaussian_dp(DataPlane &dp, const GaussianInfo &gaussian, double t) {
          g_dp.set(gaussian.weights[index++], idx_x, idx_y);
       } // end for y
    } // end for x
-   for(idx_x=0; idx_x<nx; idx_x++) {
-      for(idx_y=0; idx_y<ny; idx_y++) {
-         d_dp.set(dp.get(idx_x, idx_y), idx_x, idx_y);
-      } // end for y
-   } // end for x
-   for(idx_x=0; idx_x<nx; idx_x++) {
-      for(idx_y=0; idx_y<ny; idx_y++) {
+   d_dp = dp;
+
+   // Smooth the rows in parallel
+#pragma omp parallel for schedule(static) private(idx_x, value)
+   for(idx_y=0; idx_y<ny; idx_y++) {
+      for(idx_x=0; idx_x<nx; idx_x++) {
          value = interp_gaussian(d_dp, g_dp, (double)idx_x,
                                  (double)idx_y, max_r, t);
          dp.set(value, idx_x, idx_y);
-      } // end for y
-   } // end for x
+      } // end for x
+   } // end for y
 
    mlog << Debug(5) << "interp_gaussian_dp() "
         << "weight_sum: " << gaussian.weight_sum
@@ -0,0 +1,272 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <vector>
+
+#include "mapped_buffer.h"
+#include "vx_log.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static const char scratch_file_template [] = "met_scratch_XXXXXX";
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for class MappedBuffer
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+MappedBuffer::MappedBuffer()
+
+{
+
+init_from_scratch();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+MappedBuffer::~MappedBuffer()
+
+{
+
+clear();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+MappedBuffer::MappedBuffer(const MappedBuffer & b)
+
+{
+
+init_from_scratch();
+
+assign(b);
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+MappedBuffer & MappedBuffer::operator=(const MappedBuffer & b)
+
+{
+
+if ( this == &b )  return ( * this );
+
+assign(b);
+
+return ( * this );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void MappedBuffer::init_from_scratch()
+
+{
+
+Buf = 0;
+
+Nbytes = (bigint) 0;
+
+clear();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void MappedBuffer::clear()
+
+{
+
+if ( Buf )  {
+
+   if ( is_mapped() )  munmap(Buf, (size_t) Nbytes);
+   else                delete [] ((unsigned char *) Buf);
+
+   Buf = 0;
+
+}
+
+Nbytes = (bigint) 0;
+
+ScratchDir.clear();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void MappedBuffer::assign(const MappedBuffer & b)
+
+{
+
+clear();
+
+if ( ! b.Buf )  return;
+
+if ( b.is_mapped() )  allocate(b.Nbytes, b.ScratchDir.c_str());
+else                  allocate(b.Nbytes);
+
+memcpy(Buf, b.Buf, (size_t) Nbytes);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void MappedBuffer::allocate(bigint n)
+
+{
+
+clear();
+
+if ( n <= 0 )  return;
+
+Buf = new unsigned char [n];
+
+memset(Buf, 0, (size_t) n);
+
+Nbytes = n;
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void MappedBuffer::allocate(bigint n, const char * scratch_dir)
+
+{
+
+int fd = -1;
+void * p = 0;
+ConcatString path;
+
+clear();
+
+if ( n <= 0 )  return;
+
+   //
+   //  create and immediately unlink the scratch file
+   //
+
+path << scratch_dir << '/' << scratch_file_template;
+
+   //
+   //  mkstemp() fills in the template, so pass it a writable copy
+   //
+
+std::vector<char> tmpl(path.c_str(), path.c_str() + path.length() + 1);
+
+fd = mkstemp(&tmpl[0]);
+
+path = &tmpl[0];
+
+if ( fd < 0 )  {
+
+   mlog << Error << "\nMappedBuffer::allocate() -> "
+        << "unable to create a scratch file in directory \""
+        << scratch_dir << "\": " << strerror(errno) << "\n\n";
+
+   exit ( 1 );
+
+}
+
+unlink(path.c_str());
+
+   //
+   //  size the file and map it, zero-filled
+   //
+
+if ( ftruncate(fd, (off_t) n) < 0 )  {
+
+   mlog << Error << "\nMappedBuffer::allocate() -> "
+        << "unable to extend scratch file \"" << path << "\" to "
+        << n << " bytes: " << strerror(errno) << "\n\n";
+
+   close(fd);
+
+   exit ( 1 );
+
+}
+
+p = mmap(0, (size_t) n, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+close(fd);
+
+if ( p == MAP_FAILED )  {
+
+   mlog << Error << "\nMappedBuffer::allocate() -> "
+        << "unable to map " << n << " bytes of scratch file \""
+        << path << "\": " << strerror(errno) << "\n\n";
+
+   exit ( 1 );
+
+}
+
+Buf = p;
+
+Nbytes = n;
+
+ScratchDir = scratch_dir;
+
+mlog << Debug(4)
+     << "Mapped " << n << " bytes of scratch space in directory \""
+     << scratch_dir << "\".\n";
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
@@ -0,0 +1,101 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifndef  __MAPPED_BUFFER_H__
+#define  __MAPPED_BUFFER_H__
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#include "concat_string.h"
+#include "met_buffer.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Zero-filled block of memory that is either allocated on the heap
+   //   or backed by a memory-mapped scratch file.  The scratch file is
+   //   unlinked as soon as it is mapped, so nothing is left behind in
+   //   the scratch directory when the program exits.
+   //
+
+
+class MappedBuffer {
+
+   protected:
+
+      void init_from_scratch();
+
+      void assign(const MappedBuffer &);
+
+      void * Buf;
+
+      bigint Nbytes;
+
+      ConcatString ScratchDir;   //  empty for heap memory
+
+   public:
+
+      MappedBuffer();
+     ~MappedBuffer();
+      MappedBuffer(const MappedBuffer &);
+      MappedBuffer & operator=(const MappedBuffer &);
+
+      void clear();
+
+         //
+         //  set stuff
+         //
+
+      void allocate(bigint _bytes_);
+
+      void allocate(bigint _bytes_, const char * scratch_dir);
+
+         //
+         //  get stuff
+         //
+
+      void * buf() const;
+
+      bigint n_bytes() const;
+
+      bool is_mapped() const;
+
+      const ConcatString & scratch_dir() const;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+inline void * MappedBuffer::buf() const { return ( Buf ); }
+
+inline bigint MappedBuffer::n_bytes() const { return ( Nbytes ); }
+
+inline bool MappedBuffer::is_mapped() const { return ( ScratchDir.nonempty() ); }
+
+inline const ConcatString & MappedBuffer::scratch_dir() const { return ( ScratchDir ); }
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#endif   /*  __MAPPED_BUFFER_H__  */
+
+
+////////////////////////////////////////////////////////////////////////
+
+
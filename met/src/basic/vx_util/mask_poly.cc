@@ -128,6 +128,11 @@ V.clear();
 
 LonShift = 0.0;
 
+UMin = UMax = 0.0;
+VMin = VMax = 0.0;
+
+UseBox = false;
+
 Npoints = 0;
 
 return;
@@ -159,6 +164,14 @@ V = m.V;
 
 LonShift = m.LonShift;
 
+UMin = m.UMin;
+UMax = m.UMax;
+
+VMin = m.VMin;
+VMax = m.VMax;
+
+UseBox = m.UseBox;
+
 return;
 
 }
@@ -405,6 +418,25 @@ if ( fabs(Lon.max() - Lon.min()) > 180.0 ) {
       Lon.set(j, b);
         U.set(j, b);
    }
+}
+
+   //
+   //  store the bounding box so that points outside of it
+   //  can be rejected without testing each vertex
+   //
+
+UseBox = ( Npoints > 0 );
+
+for ( j=0; j<Npoints; j++ )  {
+
+   if ( !isfinite(U[j]) || !isfinite(V[j]) )  { UseBox = false;  break; }
+
+   if ( j == 0 || U[j] < UMin )  UMin = U[j];
+   if ( j == 0 || U[j] > UMax )  UMax = U[j];
+
+   if ( j == 0 || V[j] < VMin )  VMin = V[j];
+   if ( j == 0 || V[j] > VMax )  VMax = V[j];
+
 }
 
    //
@@ -434,6 +466,18 @@ double adj_lon;
 adj_lon  = cur_lon + LonShift;
 adj_lon -= 360.0*floor((adj_lon + 180.0)/360.0);
 
+   //
+   //  the winding number is zero outside the bounding box
+   //
+
+if ( UseBox )  {
+
+   if ( adj_lon < UMin || adj_lon > UMax )  return ( false );
+
+   if ( cur_lat < VMin || cur_lat > VMax )  return ( false );
+
+}
+
 status = is_inside(U, V, adj_lon, cur_lat);
 
 return ( status != 0 );
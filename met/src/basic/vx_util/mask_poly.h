@@ -50,6 +50,13 @@ class MaskPoly {
 
       double LonShift;
 
+         //  bounding box of U and V
+
+      double UMin, UMax;
+      double VMin, VMax;
+
+      bool UseBox;
+
       int Npoints;
 
    public:
@@ -0,0 +1,275 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+///////////////////////////////////////////////////////////////////////////////
+//
+//   Filename:   nbrhd_count_table.cc
+//
+//   Description:
+//      Contains the definition of the NbrhdCountTable class.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+#include <iostream>
+#include <algorithm>
+
+#include "nbrhd_count_table.h"
+
+#include "vx_log.h"
+#include "vx_math.h"
+
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Begin Code for class NbrhdCountTable
+//
+///////////////////////////////////////////////////////////////////////////////
+
+NbrhdCountTable::NbrhdCountTable() {
+
+   init_from_scratch();
+
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+NbrhdCountTable::~NbrhdCountTable() {
+
+   clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+NbrhdCountTable::NbrhdCountTable(const NbrhdCountTable &t) {
+
+   init_from_scratch();
+
+   assign(t);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+NbrhdCountTable & NbrhdCountTable::operator=(const NbrhdCountTable &t) {
+
+   if(this == &t) return(*this);
+
+   assign(t);
+
+   return(*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void NbrhdCountTable::init_from_scratch() {
+
+   clear();
+
+   return;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void NbrhdCountTable::assign(const NbrhdCountTable &t) {
+
+   clear();
+
+   Nx     = t.Nx;
+   Ny     = t.Ny;
+   Thresh = t.Thresh;
+   VldSum = t.VldSum;
+   ThrSum = t.ThrSum;
+
+   return;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void NbrhdCountTable::clear() {
+
+   Nx = Ny = 0;
+
+   Thresh.clear();
+
+   VldSum.clear();
+   ThrSum.clear();
+
+   return;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void NbrhdCountTable::set(const DataPlane &dp, const SingleThresh &t) {
+   int x, y;
+
+   clear();
+
+   Nx = dp.nx();
+   Ny = dp.ny();
+
+   Thresh = t;
+
+   const int nx1 = Nx + 1;
+
+   VldSum.assign(nx1*(Ny + 1), 0);
+   ThrSum.assign(nx1*(Ny + 1), 0);
+
+   const double *data = dp.data();
+
+   // Apply the threshold and sum along each row in parallel
+#pragma omp parallel for schedule(static) private(x)
+   for(y=0; y<Ny; y++) {
+      int *vld = &VldSum[(y + 1)*nx1];
+      int *thr = &ThrSum[(y + 1)*nx1];
+      const double *row = data + y*Nx;
+      for(x=0; x<Nx; x++) {
+         vld[x + 1] = vld[x];
+         thr[x + 1] = thr[x];
+         if(is_bad_data(row[x])) continue;
+         vld[x + 1]++;
+         if(t.check(row[x])) thr[x + 1]++;
+      }
+   }
+
+   // Accumulate the row sums upward
+   for(y=1; y<=Ny; y++) {
+      int *vld = &VldSum[y*nx1];
+      int *thr = &ThrSum[y*nx1];
+      const int *vld_below = &VldSum[(y - 1)*nx1];
+      const int *thr_below = &ThrSum[(y - 1)*nx1];
+      for(x=1; x<=Nx; x++) {
+         vld[x] += vld_below[x];
+         thr[x] += thr_below[x];
+      }
+   }
+
+   return;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int NbrhdCountTable::rect_sum(const vector<int> &sum,
+                              int x_ll, int y_ll, int x_ur, int y_ur) const {
+
+   // Clip the box to the grid
+   x_ll = max(x_ll, 0);
+   y_ll = max(y_ll, 0);
+   x_ur = min(x_ur, Nx - 1);
+   y_ur = min(y_ur, Ny - 1);
+
+   if(x_ll > x_ur || y_ll > y_ur) return(0);
+
+   const int nx1 = Nx + 1;
+
+   return(sum[(y_ur + 1)*nx1 + x_ur + 1] - sum[y_ll*nx1 + x_ur + 1] -
+          sum[(y_ur + 1)*nx1 + x_ll]     + sum[y_ll*nx1 + x_ll]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool NbrhdCountTable::fractional_coverage(const GridTemplate &gt,
+                                          double vld_t,
+                                          DataPlane &frac_dp) const {
+   GridPoint *gp = NULL;
+   int i, y, dy_min, dy_max;
+   vector<int> dx, dy, row_beg, row_end, row_cnt;
+   bool is_rect;
+
+   if(is_empty()) {
+      mlog << Error << "\nNbrhdCountTable::fractional_coverage() -> "
+           << "the count table has not been set.\n\n";
+      exit(1);
+   }
+
+   // Store the template offsets relative to its center
+   for(gp  = gt.getFirst(0, 0, Nx, Ny);
+       gp != NULL;
+       gp  = gt.getNext()) {
+      dx.push_back(gp->x);
+      dy.push_back(gp->y);
+   }
+
+   if(dx.empty()) return(false);
+
+   // Find the span of each template row
+   dy_min = *min_element(dy.begin(), dy.end());
+   dy_max = *max_element(dy.begin(), dy.end());
+
+   row_beg.assign(dy_max - dy_min + 1, 0);
+   row_end.assign(dy_max - dy_min + 1, -1);
+   row_cnt.assign(dy_max - dy_min + 1, 0);
+
+   for(i=0; i<(int) dx.size(); i++) {
+      int r = dy[i] - dy_min;
+      if(row_cnt[r] == 0 || dx[i] < row_beg[r]) row_beg[r] = dx[i];
+      if(row_cnt[r] == 0 || dx[i] > row_end[r]) row_end[r] = dx[i];
+      row_cnt[r]++;
+   }
+
+   // Rows with gaps cannot be counted from the tables
+   is_rect = true;
+   for(i=0; i<(int) row_cnt.size(); i++) {
+      if(row_cnt[i] != row_end[i] - row_beg[i] + 1) return(false);
+      if(row_beg[i] != row_beg[0] || row_end[i] != row_end[0]) {
+         is_rect = false;
+      }
+   }
+
+   const int n_rows = row_cnt.size();
+   const double n_tmpl = gt.size();
+
+   if(frac_dp.nx() != Nx || frac_dp.ny() != Ny) frac_dp.set_size(Nx, Ny);
+
+   double *frac = frac_dp.buf().data();
+
+   // Compute the fractional coverage, processing rows in parallel
+#pragma omp parallel for schedule(static)
+   for(y=0; y<Ny; y++) {
+
+      int x, r, n_vld, n_thr;
+
+      for(x=0; x<Nx; x++) {
+
+         // One box for rectangles
+         if(is_rect) {
+            n_vld = rect_sum(VldSum, x + row_beg[0], y + dy_min,
+                                     x + row_end[0], y + dy_max);
+            n_thr = rect_sum(ThrSum, x + row_beg[0], y + dy_min,
+                                     x + row_end[0], y + dy_max);
+         }
+         // One box per row otherwise
+         else {
+            n_vld = n_thr = 0;
+            for(r=0; r<n_rows; r++) {
+               if(row_cnt[r] == 0) continue;
+               n_vld += rect_sum(VldSum, x + row_beg[r], y + dy_min + r,
+                                         x + row_end[r], y + dy_min + r);
+               n_thr += rect_sum(ThrSum, x + row_beg[r], y + dy_min + r,
+                                         x + row_end[r], y + dy_min + r);
+            }
+         }
+
+         // Check for enough valid data and compute fractional coverage
+         if((double)(n_vld)/n_tmpl >= vld_t && n_vld != 0) {
+            frac[y*Nx + x] = (double) n_thr/n_vld;
+         }
+         else {
+            frac[y*Nx + x] = bad_data_double;
+         }
+
+      } // end for x
+   } // end for y
+
+   return(true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//
+//  End Code for class NbrhdCountTable
+//
+///////////////////////////////////////////////////////////////////////////////
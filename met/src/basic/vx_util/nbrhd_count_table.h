@@ -0,0 +1,125 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+////////////////////////////////////////////////////////////////////////
+//
+//   Filename:   nbrhd_count_table.h
+//
+//   Description:
+//      Summed-area tables of the number of valid data points and the
+//      number of points meeting a threshold, used to compute
+//      neighborhood counts for any template width in constant time
+//      per grid point.
+//
+////////////////////////////////////////////////////////////////////////
+
+#ifndef  __NBRHD_COUNT_TABLE_H__
+#define  __NBRHD_COUNT_TABLE_H__
+
+////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "data_plane.h"
+#include "threshold.h"
+#include "GridTemplate.h"
+
+////////////////////////////////////////////////////////////////////////
+
+class NbrhdCountTable {
+
+   private:
+
+      void init_from_scratch();
+
+      void assign(const NbrhdCountTable &);
+
+      int Nx;
+      int Ny;
+
+      SingleThresh Thresh;
+
+         //
+         //  (Nx + 1)*(Ny + 1) tables, where entry (x, y) holds the
+         //  count for all points to the left of x and below y
+         //
+
+      std::vector<int> VldSum;   //  valid data
+      std::vector<int> ThrSum;   //  valid data meeting the threshold
+
+      int rect_sum(const std::vector<int> &,
+                   int x_ll, int y_ll, int x_ur, int y_ur) const;
+
+   public:
+
+      NbrhdCountTable();
+     ~NbrhdCountTable();
+      NbrhdCountTable(const NbrhdCountTable &);
+      NbrhdCountTable & operator=(const NbrhdCountTable &);
+
+      void clear();
+
+         //
+         //  set stuff
+         //
+
+      void set(const DataPlane &, const SingleThresh &);
+
+         //
+         //  get stuff
+         //
+
+      int nx() const;
+      int ny() const;
+
+      const SingleThresh & thresh() const;
+
+      bool is_empty() const;
+
+         //
+         //  counts for a box, clipped to the grid
+         //
+
+      int n_vld(int x_ll, int y_ll, int x_ur, int y_ur) const;
+      int n_thr(int x_ll, int y_ll, int x_ur, int y_ur) const;
+
+         //
+         //  do stuff
+         //
+
+         //
+         //  compute the fractional coverage for a template whose rows
+         //  are contiguous, returning false for any other template
+         //
+
+      bool fractional_coverage(const GridTemplate &, double vld_t,
+                               DataPlane &frac_dp) const;
+
+};
+
+////////////////////////////////////////////////////////////////////////
+
+inline int  NbrhdCountTable::nx() const { return ( Nx ); }
+inline int  NbrhdCountTable::ny() const { return ( Ny ); }
+
+inline const SingleThresh & NbrhdCountTable::thresh() const { return ( Thresh ); }
+
+inline bool NbrhdCountTable::is_empty() const { return ( VldSum.empty() ); }
+
+inline int  NbrhdCountTable::n_vld(int x_ll, int y_ll, int x_ur, int y_ur) const
+   { return ( rect_sum(VldSum, x_ll, y_ll, x_ur, y_ur) ); }
+
+inline int  NbrhdCountTable::n_thr(int x_ll, int y_ll, int x_ur, int y_ur) const
+   { return ( rect_sum(ThrSum, x_ll, y_ll, x_ur, y_ur) ); }
+
+////////////////////////////////////////////////////////////////////////
+
+#endif   //  __NBRHD_COUNT_TABLE_H__
+
+////////////////////////////////////////////////////////////////////////
@@ -571,6 +571,24 @@ double point_dist(double x1, double y1, double x2, double y2) {
 double polyline_dist(const Polyline & a, const Polyline & b) {
    int j, k, j2, k2;
    double dist, min_dist;
+   Box a_box, b_box;
+   bool bb_overlap = true;
+
+   //
+   //  Neither containment nor intersection is possible when the
+   //  bounding boxes are disjoint, so skip those checks
+   //
+
+   if ( (a.n_points > 0) && (b.n_points > 0) )  {
+
+      a.bounding_box(a_box);
+      b.bounding_box(b_box);
+
+      bb_overlap = !( (a_box.right() < b_box.left())   ||
+                      (b_box.right() < a_box.left())   ||
+                      (a_box.top()   < b_box.bottom()) ||
+                      (b_box.top()   < a_box.bottom()) );
+   }
 
    //
    //  Check whether one polyline is completely contained inside the other
@@ -578,12 +596,12 @@ double polyline_dist(const Polyline & a, const Polyline & b) {
    //  in the other
    //
 
-   for (j=0; j<(a.n_points); ++j)  {
+   for (j=0; bb_overlap && j<(a.n_points); ++j)  {
 
       if ( b.is_inside(a.u[j], a.v[j]) )  return ( 0.0 );
    }
 
-   for (j=0; j<(b.n_points); ++j)  {
+   for (j=0; bb_overlap && j<(b.n_points); ++j)  {
 
       if ( a.is_inside(b.u[j], b.v[j]) )  return ( 0.0 );
    }
@@ -592,7 +610,7 @@ double polyline_dist(const Polyline & a, const Polyline & b) {
    //  Check to see if the polylines intersect
    //
 
-   for (j=0; j<(a.n_points); ++j)  {
+   for (j=0; bb_overlap && j<(a.n_points); ++j)  {
 
       j2 = (j + 1)%(a.n_points);
 
@@ -36,6 +36,7 @@
 #include "filename_suffix.h"
 #include "fix_float.h"
 #include "get_filenames.h"
+#include "handle_openmp.h"
 #include "grib_constants.h"
 #include "int_array.h"
 #include "interp_mthd.h"
@@ -43,6 +44,7 @@
 #include "is_number.h"
 #include "long_array.h"
 #include "make_path.h"
+#include "mapped_buffer.h"
 #include "memory.h"
 #include "num_array.h"
 #include "ordinal.h"
@@ -0,0 +1,601 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits.h>
+#include <map>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "stat_index.h"
+#include "stat_line.h"
+#include "vx_log.h"
+
+////////////////////////////////////////////////////////////////////////
+
+//
+// File format identifier, to be incremented when the layout changes
+//
+
+static const char stat_index_magic[]  = "MET_STAT_IDX";
+static const int  stat_index_version  = 1;
+
+//
+// STAT header column names in the order of STATIndexColumn
+//
+
+static const char *stat_idx_column_name[n_stat_idx_column] = {
+   "MODEL",         "DESC",
+   "FCST_LEAD",     "FCST_VALID_BEG", "FCST_VALID_END",
+   "OBS_LEAD",      "OBS_VALID_BEG",  "OBS_VALID_END",
+   "FCST_VAR",      "FCST_LEV",
+   "OBS_VAR",       "OBS_LEV",
+   "OBTYPE",        "VX_MASK",
+   "INTERP_MTHD",   "INTERP_PNTS",
+   "LINE_TYPE"
+};
+
+////////////////////////////////////////////////////////////////////////
+
+static const char * na_to_bad(const string &);
+
+static void write_int   (ofstream &, int);
+static void write_int64 (ofstream &, long long);
+static void write_string(ofstream &, const string &);
+static bool read_int    (ifstream &, int &);
+static bool read_int64  (ifstream &, long long &);
+static bool read_string (ifstream &, string &);
+
+////////////////////////////////////////////////////////////////////////
+//
+//  Code for class STATIndex
+//
+////////////////////////////////////////////////////////////////////////
+
+STATIndex::STATIndex() {
+
+   init_from_scratch();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+STATIndex::~STATIndex() {
+
+   clear();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+STATIndex::STATIndex(const STATIndex &s) {
+
+   init_from_scratch();
+
+   assign(s);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+STATIndex & STATIndex::operator=(const STATIndex &s) {
+
+   if(this == &s) return(*this);
+
+   assign(s);
+
+   return(*this);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void STATIndex::init_from_scratch() {
+
+   clear();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void STATIndex::assign(const STATIndex &s) {
+
+   clear();
+
+   StatFile  = s.StatFile;
+   FileSize  = s.FileSize;
+   FileMtime = s.FileMtime;
+   Offset    = s.Offset;
+   IsHeader  = s.IsHeader;
+
+   for(int i=0; i<n_stat_idx_column; i++) {
+      Dict[i] = s.Dict[i];
+      Code[i] = s.Code[i];
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void STATIndex::clear() {
+
+   StatFile.clear();
+   FileSize  = 0;
+   FileMtime = 0;
+   Offset.clear();
+   IsHeader.clear();
+
+   for(int i=0; i<n_stat_idx_column; i++) {
+      Dict[i].clear();
+      Code[i].clear();
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool STATIndex::file_info(const char *path, long long &size,
+                          long long &mtime) const {
+   struct stat sbuf;
+
+   if(stat(path, &sbuf) != 0) return(false);
+
+   size  = (long long) sbuf.st_size;
+   mtime = (long long) sbuf.st_mtime;
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool STATIndex::build(const char *stat_file) {
+   int i;
+   long long pos;
+   STATLine line;
+   LineDataFile f;
+   map<string,int> code_map[n_stat_idx_column];
+   map<string,int>::iterator it;
+   string s;
+
+   clear();
+
+   if(!file_info(stat_file, FileSize, FileMtime) ||
+      !f.open(stat_file)) {
+      mlog << Error << "\nSTATIndex::build() -> "
+           << "unable to open input stat file \""
+           << stat_file << "\"\n\n";
+      return(false);
+   }
+
+   StatFile = stat_file;
+
+   //
+   // Store the offset of each line read, in the same way as when
+   // the file is read sequentially
+   //
+   pos = (long long) f.in->tellg();
+
+   while(f >> line) {
+
+      if(line.type() != no_stat_line_type) {
+
+         Offset.push_back(pos);
+         IsHeader.push_back(line.is_header() ? 1 : 0);
+
+         for(i=0; i<n_stat_idx_column; i++) {
+
+            if(line.is_header()) {
+               Code[i].push_back(-1);
+               continue;
+            }
+
+            s  = line.get_item(stat_idx_column_name[i], false);
+            it = code_map[i].find(s);
+
+            if(it == code_map[i].end()) {
+               it = code_map[i].insert(pair<string,int>(s, (int) Dict[i].size())).first;
+               Dict[i].push_back(s);
+            }
+
+            Code[i].push_back(it->second);
+         }
+      }
+
+      pos = (long long) f.in->tellg();
+
+   } // end while
+
+   f.close();
+
+   mlog << Debug(4) << "Indexed " << n_lines() << " lines of STAT file \""
+        << stat_file << "\".\n";
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool STATIndex::read(const char *index_file, const char *stat_file) {
+   ifstream in;
+   long long size, mtime, n64;
+   int i, j, n, version;
+   string s;
+
+   clear();
+
+   //
+   // Check that the size and modification time of the STAT file have
+   // not changed since it was indexed
+   //
+   if(!file_info(stat_file, size, mtime)) return(false);
+
+   in.open(index_file, ios::in | ios::binary);
+
+   if(!in) return(false);
+
+   if(!read_string(in, s) || s != stat_index_magic ||
+      !read_int(in, version) || version != stat_index_version ||
+      !read_int64(in, FileSize) || !read_int64(in, FileMtime) ||
+      FileSize != size || FileMtime != mtime ||
+      !read_int(in, n) || n < 0) {
+      clear();
+      return(false);
+   }
+
+   Offset.resize(n);
+   IsHeader.resize(n);
+
+   for(i=0; i<n; i++) {
+      if(!read_int64(in, Offset[i])) { clear(); return(false); }
+   }
+
+   if(n > 0) in.read(&IsHeader[0], n);
+
+   //
+   // Read the dictionary and codes for each column
+   //
+   for(i=0; i<n_stat_idx_column; i++) {
+
+      if(!read_int64(in, n64) || n64 < 0) { clear(); return(false); }
+
+      Dict[i].resize(n64);
+
+      for(j=0; j<n64; j++) {
+         if(!read_string(in, Dict[i][j])) { clear(); return(false); }
+      }
+
+      Code[i].resize(n);
+
+      if(n > 0) in.read((char *) &Code[i][0], n*sizeof(int));
+
+      for(j=0; j<n; j++) {
+         if(Code[i][j] < -1 || Code[i][j] >= (int) Dict[i].size()) {
+            clear();
+            return(false);
+         }
+      }
+   }
+
+   if(!in) { clear(); return(false); }
+
+   in.close();
+
+   StatFile = stat_file;
+
+   mlog << Debug(4) << "Read index of " << n_lines()
+        << " lines for STAT file \"" << stat_file << "\" from \""
+        << index_file << "\".\n";
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool STATIndex::write(const char *index_file) const {
+   ofstream out;
+   ConcatString tmp_file;
+   int i, j, n;
+
+   //
+   // Write to a temporary file and rename it so that concurrent runs
+   // never read a partial index
+   //
+   tmp_file << index_file << ".tmp." << (int) getpid();
+
+   out.open(tmp_file.c_str(), ios::out | ios::binary | ios::trunc);
+
+   if(!out) {
+      mlog << Warning << "\nSTATIndex::write() -> "
+           << "unable to open index file \"" << tmp_file
+           << "\" for writing.\n\n";
+      return(false);
+   }
+
+   n = n_lines();
+
+   write_string(out, stat_index_magic);
+   write_int   (out, stat_index_version);
+   write_int64 (out, FileSize);
+   write_int64 (out, FileMtime);
+   write_int   (out, n);
+
+   for(i=0; i<n; i++) write_int64(out, Offset[i]);
+
+   if(n > 0) out.write(&IsHeader[0], n);
+
+   for(i=0; i<n_stat_idx_column; i++) {
+
+      write_int64(out, (long long) Dict[i].size());
+
+      for(j=0; j<(int) Dict[i].size(); j++) write_string(out, Dict[i][j]);
+
+      if(n > 0) out.write((const char *) &Code[i][0], n*sizeof(int));
+   }
+
+   out.close();
+
+   if(!out) {
+      mlog << Warning << "\nSTATIndex::write() -> "
+           << "trouble writing index file \"" << tmp_file << "\".\n\n";
+      remove(tmp_file.c_str());
+      return(false);
+   }
+
+   if(rename(tmp_file.c_str(), index_file) != 0) {
+      mlog << Warning << "\nSTATIndex::write() -> "
+           << "unable to rename \"" << tmp_file << "\" to \""
+           << index_file << "\".\n\n";
+      remove(tmp_file.c_str());
+      return(false);
+   }
+
+   mlog << Debug(4) << "Wrote index of " << n << " lines for STAT file \""
+        << StatFile << "\" to \"" << index_file << "\".\n";
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Apply the job filtering criteria for a single column to each of its
+// distinct values.  This mirrors STATAnalysisJob::is_keeper() for the
+// criteria that depend only on that column and returns false when the
+// job places no constraint on it.
+//
+////////////////////////////////////////////////////////////////////////
+
+bool STATIndex::column_filter(STATIndexColumn c, const STATAnalysisJob &job,
+                              vector<char> &pass) const {
+   const StringArray *sa = (const StringArray *) 0;
+   const IntArray *ia    = (const IntArray *) 0;
+   const TimeArray *inc  = (const TimeArray *) 0;
+   const TimeArray *exc  = (const TimeArray *) 0;
+   unixtime beg = 0, end = 0, t;
+   int i;
+   bool keep;
+
+   switch(c) {
+      case stat_idx_model:       sa = &job.model;       break;
+      case stat_idx_desc:        sa = &job.desc;        break;
+      case stat_idx_fcst_var:    sa = &job.fcst_var;    break;
+      case stat_idx_fcst_lev:    sa = &job.fcst_lev;    break;
+      case stat_idx_obs_var:     sa = &job.obs_var;     break;
+      case stat_idx_obs_lev:     sa = &job.obs_lev;     break;
+      case stat_idx_obtype:      sa = &job.obtype;      break;
+      case stat_idx_vx_mask:     sa = &job.vx_mask;     break;
+      case stat_idx_interp_mthd: sa = &job.interp_mthd; break;
+      case stat_idx_line_type:   sa = &job.line_type;   break;
+
+      case stat_idx_fcst_lead:   ia = &job.fcst_lead;   break;
+      case stat_idx_obs_lead:    ia = &job.obs_lead;    break;
+
+      case stat_idx_fcst_valid_beg:
+         beg = job.fcst_valid_beg;
+         inc = &job.fcst_valid_inc;
+         exc = &job.fcst_valid_exc;
+         break;
+
+      case stat_idx_fcst_valid_end:
+         end = job.fcst_valid_end;
+         inc = &job.fcst_valid_inc;
+         exc = &job.fcst_valid_exc;
+         break;
+
+      case stat_idx_obs_valid_beg:
+         beg = job.obs_valid_beg;
+         inc = &job.obs_valid_inc;
+         exc = &job.obs_valid_exc;
+         break;
+
+      case stat_idx_obs_valid_end:
+         end = job.obs_valid_end;
+         inc = &job.obs_valid_inc;
+         exc = &job.obs_valid_exc;
+         break;
+
+      case stat_idx_interp_pnts:
+         break;
+
+      default:
+         return(false);
+   }
+
+   //
+   // Check for a constraint on this column
+   //
+   if(sa && sa->n() == 0) return(false);
+   if(ia && ia->n() == 0) return(false);
+   if(inc && beg <= 0 && end <= 0 && inc->n() == 0 && exc->n() == 0) return(false);
+   if(c == stat_idx_interp_pnts && job.interp_pnts.n() == 0) return(false);
+
+   pass.resize(Dict[c].size());
+
+   for(i=0; i<(int) Dict[c].size(); i++) {
+
+      const string &s = Dict[c][i];
+
+      if(sa) {
+         keep = sa->has(s);
+      }
+      else if(ia) {
+         keep = ia->has(timestring_to_sec(na_to_bad(s)));
+      }
+      else if(inc) {
+         t    = timestring_to_unix(na_to_bad(s));
+         keep = !(beg > 0 && t < beg) &&
+                !(end > 0 && t > end) &&
+                (inc->n() == 0 ||  inc->has(t)) &&
+                (exc->n() == 0 || !exc->has(t));
+      }
+      else {
+         keep = job.interp_pnts.has(atoi(s.c_str()));
+      }
+
+      pass[i] = (keep ? 1 : 0);
+   }
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void STATIndex::select(const STATAnalysisJob &job, vector<int> &rows) const {
+   vector<char> pass[n_stat_idx_column];
+   bool active[n_stat_idx_column];
+   int i, j, n_active;
+   bool keep;
+
+   rows.clear();
+
+   //
+   // Filter the distinct values of each column
+   //
+   for(j=0,n_active=0; j<n_stat_idx_column; j++) {
+      active[j] = column_filter((STATIndexColumn) j, job, pass[j]);
+      if(active[j]) n_active++;
+   }
+
+   //
+   // Check each line against the active columns
+   //
+   for(i=0; i<n_lines(); i++) {
+
+      keep = true;
+
+      if(!IsHeader[i] && n_active > 0) {
+         for(j=0; j<n_stat_idx_column && keep; j++) {
+            if(active[j] && !pass[j][Code[j][i]]) keep = false;
+         }
+      }
+
+      if(keep) rows.push_back(i);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+//  Code for misc functions
+//
+////////////////////////////////////////////////////////////////////////
+
+ConcatString stat_index_filename(const char *index_dir,
+                                 const char *stat_file) {
+   ConcatString cs;
+   unsigned long long h = 14695981039346656037ULL;
+   const char *c, *path;
+   char abs_path[PATH_MAX], junk[32];
+
+   //
+   // Hash the full path to distinguish files with the same name
+   // in different directories (64-bit FNV-1a)
+   //
+   path = (realpath(stat_file, abs_path) ? abs_path : stat_file);
+
+   for(c=path; *c; c++) {
+      h ^= (unsigned char) *c;
+      h *= 1099511628211ULL;
+   }
+
+   snprintf(junk, sizeof(junk), "%016llx", h);
+
+   cs << index_dir << "/" << get_short_name(stat_file) << "_"
+      << junk << stat_index_file_ext;
+
+   return(cs);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+const char * na_to_bad(const string &s) {
+
+   //
+   // Interpret the NA string as bad data, as in STATLine::get_item()
+   //
+   return(s == na_str ? bad_data_str : s.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void write_int(ofstream &out, int i) {
+   out.write((const char *) &i, sizeof(int));
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void write_int64(ofstream &out, long long i) {
+   out.write((const char *) &i, sizeof(long long));
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void write_string(ofstream &out, const string &s) {
+   write_int(out, (int) s.length());
+   out.write(s.data(), s.length());
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool read_int(ifstream &in, int &i) {
+   in.read((char *) &i, sizeof(int));
+   return(!in.fail());
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool read_int64(ifstream &in, long long &i) {
+   in.read((char *) &i, sizeof(long long));
+   return(!in.fail());
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool read_string(ifstream &in, string &s) {
+   int n;
+
+   if(!read_int(in, n) || n < 0) return(false);
+
+   s.resize(n);
+   if(n > 0) in.read(&s[0], n);
+
+   return(!in.fail());
+}
+
+////////////////////////////////////////////////////////////////////////
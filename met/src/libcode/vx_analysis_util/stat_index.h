@@ -0,0 +1,169 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+////////////////////////////////////////////////////////////////////////
+//
+//   Filename:   stat_index.h
+//
+//   Description:
+//      Binary index of the header columns of a STAT file.  Each
+//      indexed column is stored as a dictionary of its distinct values
+//      and one dictionary code per line, along with the byte offset of
+//      each line, so that the job filtering criteria can be applied
+//      to the distinct values once and only the candidate lines need
+//      to be parsed.
+//
+////////////////////////////////////////////////////////////////////////
+
+#ifndef  __STAT_INDEX_H__
+#define  __STAT_INDEX_H__
+
+////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "stat_job.h"
+
+////////////////////////////////////////////////////////////////////////
+
+static const char stat_index_file_ext[] = ".idx";
+
+//
+// Indexed STAT header columns
+//
+
+enum STATIndexColumn {
+   stat_idx_model = 0,
+   stat_idx_desc,
+   stat_idx_fcst_lead,
+   stat_idx_fcst_valid_beg,
+   stat_idx_fcst_valid_end,
+   stat_idx_obs_lead,
+   stat_idx_obs_valid_beg,
+   stat_idx_obs_valid_end,
+   stat_idx_fcst_var,
+   stat_idx_fcst_lev,
+   stat_idx_obs_var,
+   stat_idx_obs_lev,
+   stat_idx_obtype,
+   stat_idx_vx_mask,
+   stat_idx_interp_mthd,
+   stat_idx_interp_pnts,
+   stat_idx_line_type,
+
+   n_stat_idx_column
+};
+
+////////////////////////////////////////////////////////////////////////
+
+class STATIndex {
+
+   private:
+
+      void init_from_scratch();
+
+      void assign(const STATIndex &);
+
+      ConcatString StatFile;
+
+         //
+         //  size and modification time of the STAT file when indexed
+         //
+
+      long long FileSize;
+      long long FileMtime;
+
+         //
+         //  byte offset of each line and whether it is a header line
+         //
+
+      std::vector<long long> Offset;
+      std::vector<char>      IsHeader;
+
+         //
+         //  distinct values of each column and the code for each line,
+         //  which is -1 for header lines
+         //
+
+      std::vector<std::string> Dict[n_stat_idx_column];
+      std::vector<int>         Code[n_stat_idx_column];
+
+      bool file_info(const char *, long long &, long long &) const;
+
+      bool column_filter(STATIndexColumn, const STATAnalysisJob &,
+                         std::vector<char> &) const;
+
+   public:
+
+      STATIndex();
+     ~STATIndex();
+      STATIndex(const STATIndex &);
+      STATIndex & operator=(const STATIndex &);
+
+      void clear();
+
+         //
+         //  set stuff
+         //
+
+         //  Index the lines of a STAT file
+
+      bool build(const char *stat_file);
+
+         //  Read an index file, returning false when it is missing,
+         //  corrupt, or out of date with respect to the STAT file
+
+      bool read(const char *index_file, const char *stat_file);
+
+      bool write(const char *index_file) const;
+
+         //
+         //  get stuff
+         //
+
+      const ConcatString & stat_file() const;
+
+      int n_lines() const;
+
+      long long offset(int) const;
+
+      bool is_header(int) const;
+
+         //
+         //  do stuff
+         //
+
+         //  Store the indices of the lines that may satisfy the job
+         //  filtering criteria, always including the header lines.
+         //  The candidates must still be checked with is_keeper().
+
+      void select(const STATAnalysisJob &, std::vector<int> &) const;
+
+};
+
+////////////////////////////////////////////////////////////////////////
+
+inline const ConcatString & STATIndex::stat_file() const { return(StatFile); }
+
+inline int STATIndex::n_lines() const { return((int) Offset.size()); }
+
+inline long long STATIndex::offset(int i) const { return(Offset[i]); }
+
+inline bool STATIndex::is_header(int i) const { return(IsHeader[i] != 0); }
+
+////////////////////////////////////////////////////////////////////////
+
+extern ConcatString stat_index_filename(const char *index_dir,
+                                        const char *stat_file);
+
+////////////////////////////////////////////////////////////////////////
+
+#endif   //  __STAT_INDEX_H__
+
+////////////////////////////////////////////////////////////////////////
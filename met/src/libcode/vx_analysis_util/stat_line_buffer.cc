@@ -0,0 +1,268 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <stdlib.h>
+
+#include "stat_line_buffer.h"
+
+#include "vx_util.h"
+#include "vx_log.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for class STATLineBuffer
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+STATLineBuffer::STATLineBuffer()
+
+{
+
+init_from_scratch();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+STATLineBuffer::~STATLineBuffer()
+
+{
+
+clear();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+STATLineBuffer::STATLineBuffer(const STATLineBuffer & b)
+
+{
+
+init_from_scratch();
+
+assign(b);
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+STATLineBuffer & STATLineBuffer::operator=(const STATLineBuffer & b)
+
+{
+
+if ( this == &b )  return ( * this );
+
+assign(b);
+
+return ( * this );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void STATLineBuffer::init_from_scratch()
+
+{
+
+clear();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void STATLineBuffer::assign(const STATLineBuffer & b)
+
+{
+
+clear();
+
+Filename = b.Filename;
+Lines    = b.Lines;
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void STATLineBuffer::clear()
+
+{
+
+Filename.clear();
+
+Lines.clear();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool STATLineBuffer::read(const char * path)
+
+{
+
+LineDataFile f;
+STATLine line;
+
+clear();
+
+if ( !f.open(path) )  return ( false );
+
+Filename = path;
+
+   //
+   //  store each line exactly as it is returned by the file, including
+   //  the header lines
+   //
+
+while ( f >> line )  Lines.push_back(line);
+
+f.close();
+
+mlog << Debug(4)
+     << "Buffered " << n_lines() << " lines of STAT file \""
+     << Filename << "\".\n";
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for class STATLineBufferFile
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+STATLineBufferFile::STATLineBufferFile()
+
+{
+
+Buffer = (const STATLineBuffer *) 0;
+
+Pos = 0;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+STATLineBufferFile::~STATLineBufferFile()
+
+{
+
+Buffer = (const STATLineBuffer *) 0;
+
+Pos = 0;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void STATLineBufferFile::open(const STATLineBuffer & b)
+
+{
+
+close();
+
+Buffer = &b;
+
+Pos = 0;
+
+Filename.assign(b.filename());
+ShortFilename.assign(get_short_name(b.filename()));
+
+Last_Line_Number = 0;
+
+Header.clear();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int STATLineBufferFile::operator>>(DataLine & a)
+
+{
+
+STATLine * line = dynamic_cast<STATLine *>(&a);
+
+if ( !line )  {
+
+   mlog << Error << "\nSTATLineBufferFile::operator>>(DataLine &) -> "
+        << "only STAT lines can be read from a buffered STAT file\n\n";
+
+   exit ( 1 );
+
+}
+
+if ( !Buffer || Pos >= Buffer->n_lines() )  return ( 0 );
+
+*line = Buffer->line(Pos++);
+
+   //
+   //  the buffered line refers back to the file it was parsed from
+   //
+
+set_line_file(*line);
+
+++Last_Line_Number;
+
+if ( line->is_header() )  set_header(*line);
+
+return ( 1 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
@@ -0,0 +1,123 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifndef  __STAT_LINE_BUFFER_H__
+#define  __STAT_LINE_BUFFER_H__
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#include <vector>
+
+#include "stat_line.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  The parsed lines of a STAT file, read once so that they can be
+   //  replayed by any number of readers
+   //
+
+
+class STATLineBuffer {
+
+   private:
+
+      void init_from_scratch();
+
+      void assign(const STATLineBuffer &);
+
+      ConcatString Filename;
+
+      std::vector<STATLine> Lines;
+
+   public:
+
+      STATLineBuffer();
+     ~STATLineBuffer();
+      STATLineBuffer(const STATLineBuffer &);
+      STATLineBuffer & operator=(const STATLineBuffer &);
+
+      void clear();
+
+         //
+         //  set stuff
+         //
+
+      bool read(const char *path);
+
+         //
+         //  get stuff
+         //
+
+      const char * filename() const;
+
+      int n_lines() const;
+
+      const STATLine & line(int) const;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+inline const char * STATLineBuffer::filename() const { return ( Filename.c_str() ); }
+
+inline int STATLineBuffer::n_lines() const { return ( (int) Lines.size() ); }
+
+inline const STATLine & STATLineBuffer::line(int i) const { return ( Lines[i] ); }
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Reads the lines of a STATLineBuffer as if they were being read
+   //  from the original file.  The buffer is not modified, so multiple
+   //  readers may share it across threads.
+   //
+
+
+class STATLineBufferFile : public LineDataFile {
+
+   private:
+
+      STATLineBufferFile(const STATLineBufferFile &);
+      STATLineBufferFile & operator=(const STATLineBufferFile &);
+
+      const STATLineBuffer * Buffer;   //  not allocated
+
+      int Pos;
+
+   public:
+
+      STATLineBufferFile();
+     ~STATLineBufferFile();
+
+      void open(const STATLineBuffer &);
+
+      int operator>>(DataLine &);   //  virtual from base class
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#endif   /*  __STAT_LINE_BUFFER_H__  */
+
+
+////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,8 @@
 #include "time_series.h"
 #include "stat_job.h"
 #include "stat_line.h"
+#include "stat_index.h"
+#include "stat_line_buffer.h"
 
 ////////////////////////////////////////////////////////////////////////
 
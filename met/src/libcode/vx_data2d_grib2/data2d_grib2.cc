@@ -24,6 +24,7 @@ using namespace std;
 #include <utility>
 #include <limits>
 #include <list>
+#include <sys/stat.h>
 
 #include "data2d_grib2.h"
 #include "grib_strings.h"
@@ -42,6 +43,27 @@ using namespace std;
 
 double scaled2dbl(int scale_factor, int scale_value);
 
+////////////////////////////////////////////////////////////////////////
+//
+// Inventories of the GRIB2 files already scanned, so that opening the
+// same file again does not require reading every record.  A file is
+// identified by its device, inode, size, and modification time.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct Grib2Inventory {
+   string              Key;
+   vector<Grib2Record> RecList;
+   Grid                RawGrid;
+   int                 ScanMode;
+};
+
+static const int grib2_inventory_cache_size = 32;
+
+static list<Grib2Inventory> grib2_inventory_cache;   //  most recently used first
+
+static bool grib2_inventory_key(const char *filename, string &key);
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Code for class MetGrib2DataFile
@@ -110,7 +132,11 @@ bool MetGrib2DataFile::open(const char * _filename) {
       exit(1);
    }
 
-   if( 1 > RecList.size() ) read_grib2_record_list();
+   //  reuse the inventory of this file, if already scanned
+   if( 1 > RecList.size() && !read_grib2_inventory() ){
+      read_grib2_record_list();
+      add_grib2_inventory();
+   }
 
    bool status = ( 0 < RecList.size() );
    if( !status ){
@@ -937,6 +963,96 @@ void MetGrib2DataFile::read_grib2_record_list() {
 
 ////////////////////////////////////////////////////////////////////////
 
+bool MetGrib2DataFile::read_grib2_inventory() {
+   string key;
+   bool found = false;
+
+   if( !grib2_inventory_key(Filename.c_str(), key) ) return false;
+
+   //  files may be opened concurrently, so only one thread
+   //  searches or updates the cache at a time
+   #pragma omp critical(met_grib2_inventory)
+   {
+      list<Grib2Inventory>::iterator it;
+      for(it = grib2_inventory_cache.begin(); it != grib2_inventory_cache.end(); it++){
+         if( it->Key == key ) break;
+      }
+
+      if( it != grib2_inventory_cache.end() ){
+
+         //  copy the records and rebuild the wind pair lookup
+         for(size_t i=0; i < it->RecList.size(); i++){
+            Grib2Record *rec = new Grib2Record(it->RecList[i]);
+            RecList.push_back(rec);
+            NameRecMap[build_magic(rec).text()] = rec;
+         }
+
+         //  restore the grid
+         if( it->RawGrid.nxy() > 0 ){
+            Raw_Grid = new Grid(it->RawGrid);
+            copy_raw_grid_to_dest();
+         }
+         ScanMode = it->ScanMode;
+
+         //  mark as the most recently used
+         grib2_inventory_cache.splice(grib2_inventory_cache.begin(),
+                                      grib2_inventory_cache, it);
+         found = true;
+      }
+   }
+
+   if( found ){
+      mlog << Debug(4) << "MetGrib2DataFile::read_grib2_inventory() - "
+           << "reusing the inventory of " << RecList.size()
+           << " fields from GRIB2 file: " << Filename << "\n";
+   }
+
+   return found;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void MetGrib2DataFile::add_grib2_inventory() {
+   string key;
+
+   if( 1 > RecList.size() ||
+       !grib2_inventory_key(Filename.c_str(), key) ) return;
+
+   Grib2Inventory inv;
+   inv.Key = key;
+   for(size_t i=0; i < RecList.size(); i++) inv.RecList.push_back(*RecList[i]);
+   if( Raw_Grid ) inv.RawGrid = *Raw_Grid;
+   inv.ScanMode = ScanMode;
+
+   #pragma omp critical(met_grib2_inventory)
+   {
+      grib2_inventory_cache.push_front(inv);
+
+      //  drop the least recently used
+      if( (int) grib2_inventory_cache.size() > grib2_inventory_cache_size ){
+         grib2_inventory_cache.pop_back();
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool grib2_inventory_key(const char *filename, string &key) {
+   struct stat sbuf;
+
+   if( 0 != stat(filename, &sbuf) ) return false;
+
+   key = str_format("%lld_%lld_%lld_%lld",
+                    (long long) sbuf.st_dev,  (long long) sbuf.st_ino,
+                    (long long) sbuf.st_size, (long long) sbuf.st_mtime).text();
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////
+
 void MetGrib2DataFile::read_grib2_grid( gribfield *gfld) {
 
    double d, r_km;
@@ -106,6 +106,10 @@ class MetGrib2DataFile : public Met2dDataFile {
 
       void read_grib2_record_list();
 
+      //  reuse or store the record list and grid of this file
+      bool read_grib2_inventory();
+      void add_grib2_inventory();
+
       DataPlane check_uv_rotation( VarInfoGrib2 *vinfo,
                                    Grib2Record *rec,
                                    DataPlane plane
@@ -45,9 +45,9 @@ static const int  max_met_args           = 30;
 
 ////////////////////////////////////////////////////////////////////////
 
-template <typename T>
+template <typename T, typename D>
 
-void copy_nc_data_as_double(double *to_array, const T *from_array,
+void copy_nc_data(D *to_array, const T *from_array,
                             const int x_slot, const int y_slot,
                             const int nx, const int ny,
                             double missing_value, double fill_value,
@@ -65,7 +65,7 @@ void copy_nc_data_as_double(double *to_array, const T *from_array,
                if(is_eq(value, missing_value) || is_eq(value, fill_value))
                   value = bad_data_double;
                else value = value * scale_factor + add_offset;
-               to_array[offset++] = value;
+               to_array[offset++] = (D) value;
             }
          }
       }
@@ -77,7 +77,7 @@ void copy_nc_data_as_double(double *to_array, const T *from_array,
                if(is_eq(value, missing_value) || is_eq(value, fill_value))
                   value = bad_data_double;
                else value = value * scale_factor + add_offset;
-               to_array[offset++] = value;
+               to_array[offset++] = (D) value;
             }
          }
       }
@@ -90,7 +90,7 @@ void copy_nc_data_as_double(double *to_array, const T *from_array,
                value = (double)from_array[x + start_offset];
                if(is_eq(value, missing_value) || is_eq(value, fill_value))
                   value = bad_data_double;
-               to_array[offset++] = value;
+               to_array[offset++] = (D) value;
             }
          }
       }
@@ -101,7 +101,7 @@ void copy_nc_data_as_double(double *to_array, const T *from_array,
                value = (double)from_array[y + start_offset];
                if(is_eq(value, missing_value) || is_eq(value, fill_value))
                   value = bad_data_double;
-               to_array[offset++] = value;
+               to_array[offset++] = (D) value;
             }
          }
       }
@@ -110,7 +110,9 @@ void copy_nc_data_as_double(double *to_array, const T *from_array,
 
 ////////////////////////////////////////////////////////////////////////
 
-void check_nc_data_2d(const double *from_array, const int nx, const int ny,
+template <typename D>
+
+void check_nc_data_2d(const D *from_array, const int nx, const int ny,
                       const double missing_value) {
    int count_zero, count_missing, count_valid;
    count_zero = count_missing = count_valid = 0;
@@ -714,39 +716,52 @@ plane.set_size(Nx, Ny);
    float *float_array = (float *)0;
    double *double_array = (double *)0;
 
-   double *data_array = new double[cell_count];
+      //
+      //  single precision planes are filled directly
+      //
+
+   float *fdata_array = (plane.is_float() ? plane.fbuf() : (float *)0);
+   double *data_array = (fdata_array ? (double *)0 : new double[cell_count]);
    clock_time = clock();
    
    switch ( type_id ) {
       case NcType::nc_INT:
          int_array = new int[cell_count];
          get_nc_data(v, int_array, dim, cur);
-         copy_nc_data_as_double(data_array, int_array, x_slot, y_slot, Nx, Ny,
-                                missing_value, fill_value, add_offset, scale_factor);
+         if (fdata_array) copy_nc_data(fdata_array, int_array, x_slot, y_slot, Nx, Ny,
+                                       missing_value, fill_value, add_offset, scale_factor);
+         else             copy_nc_data(data_array, int_array, x_slot, y_slot, Nx, Ny,
+                                       missing_value, fill_value, add_offset, scale_factor);
          if (int_array) delete[] int_array;
          break;
 
       case NcType::nc_SHORT:
          short_array = new short[cell_count];
          get_nc_data(v, short_array, dim, cur);
-         copy_nc_data_as_double(data_array, short_array, x_slot, y_slot, Nx, Ny,
-                                missing_value, fill_value, add_offset, scale_factor);
+         if (fdata_array) copy_nc_data(fdata_array, short_array, x_slot, y_slot, Nx, Ny,
+                                       missing_value, fill_value, add_offset, scale_factor);
+         else             copy_nc_data(data_array, short_array, x_slot, y_slot, Nx, Ny,
+                                       missing_value, fill_value, add_offset, scale_factor);
          if (short_array) delete[] short_array;
          break;
 
       case NcType::nc_FLOAT:
          float_array = new float[cell_count];
          get_nc_data(v, float_array, dim, cur);
-         copy_nc_data_as_double(data_array, float_array, x_slot, y_slot, Nx, Ny,
-                                missing_value, fill_value, add_offset, scale_factor);
+         if (fdata_array) copy_nc_data(fdata_array, float_array, x_slot, y_slot, Nx, Ny,
+                                       missing_value, fill_value, add_offset, scale_factor);
+         else             copy_nc_data(data_array, float_array, x_slot, y_slot, Nx, Ny,
+                                       missing_value, fill_value, add_offset, scale_factor);
          if (float_array) delete[] float_array;
          break;
 
       case NcType::nc_DOUBLE:
          double_array = new double[cell_count];
          get_nc_data(v, double_array, dim, cur);
-         copy_nc_data_as_double(data_array, double_array, x_slot, y_slot, Nx, Ny,
-                                missing_value, fill_value, add_offset, scale_factor);
+         if (fdata_array) copy_nc_data(fdata_array, double_array, x_slot, y_slot, Nx, Ny,
+                                       missing_value, fill_value, add_offset, scale_factor);
+         else             copy_nc_data(data_array, double_array, x_slot, y_slot, Nx, Ny,
+                                       missing_value, fill_value, add_offset, scale_factor);
          if (double_array) delete[] double_array;
          break;
 
@@ -761,14 +776,15 @@ plane.set_size(Nx, Ny);
    nc_time = clock();
    if (mlog.verbosity_level() >= 7) {
       double duration_sec = (double)(nc_time - clock_time)/CLOCKS_PER_SEC;
-      check_nc_data_2d(data_array, Nx, Ny, missing_value);
+      if (fdata_array) check_nc_data_2d(fdata_array, Nx, Ny, missing_value);
+      else             check_nc_data_2d(data_array, Nx, Ny, missing_value);
       mlog << Debug(7) << method_name_short << "took " << duration_sec
            << " seconds to read NetCDF data\n";
    }
    
-   plane.set_block(data_array, Nx, Ny);
+   if (data_array) plane.set_block(data_array, Nx, Ny);
    
-   if (mlog.verbosity_level() >= 7) {
+   if (data_array && mlog.verbosity_level() >= 7) {
       double duration_sec = (double)(clock() - nc_time)/CLOCKS_PER_SEC;
       mlog << Debug(7) << method_name_short << "took " << duration_sec
            << " seconds to fill data plane\n";
@@ -168,7 +168,7 @@ void Shp_Array<T>::assign(const Shp_Array<T> & a)
 
 clear();
 
-if ( a.n_elements() == 0 )  return;
+if ( a.n() == 0 )  return;
 
 add(a);
 
@@ -339,9 +339,9 @@ void Shp_Array<T>::add(const Shp_Array<T> & a)
 
 int j;
 
-extend(Nelements + a.n_elements());
+extend(Nelements + a.n());
 
-for (j=0; j<(a.n_elements()); ++j)  {
+for (j=0; j<(a.n()); ++j)  {
 
    add(a[j]);
 
@@ -72,6 +72,50 @@ void rng_set(gsl_rng *&r, const char *rng_name, const char *rng_seed) {
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Allocate a new random number generator of the same type and in the
+// same state as the source.
+//
+////////////////////////////////////////////////////////////////////////
+
+void rng_clone(gsl_rng *&r, const gsl_rng *src) {
+
+   r = gsl_rng_clone(src);
+
+   if(r == NULL) {
+      mlog << Error << "\nrng_clone() -> "
+           << "error allocating the random number generator!\n\n";
+      exit(1);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Reset the random number generator using the seed specified.
+//
+////////////////////////////////////////////////////////////////////////
+
+void rng_seed(const gsl_rng *r, unsigned long seed) {
+
+   gsl_rng_set(r, seed);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Return the next random integer from the generator.
+//
+////////////////////////////////////////////////////////////////////////
+
+unsigned long rng_get(const gsl_rng *r) {
+
+   return(gsl_rng_get(r));
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Free any memory associated with this random number generator.
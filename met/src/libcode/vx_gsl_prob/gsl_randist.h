@@ -40,6 +40,9 @@ enum DistType {
 ////////////////////////////////////////////////////////////////////////
 
 extern void rng_set(gsl_rng *&r, const char *, const char *);
+extern void rng_clone(gsl_rng *&r, const gsl_rng *);
+extern void rng_seed(const gsl_rng *r, unsigned long);
+extern unsigned long rng_get(const gsl_rng *r);
 extern void rng_free(gsl_rng *r);
 
 ////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1011 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <unistd.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "regrid_plan.h"
+
+#include "vx_util.h"
+#include "vx_math.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static const char regrid_plan_magic [] = "MET_REGRID_PLAN";
+
+static const int regrid_plan_version = 1;
+
+static const int regrid_plan_debug_level = 4;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static vector<RegridPlan *> plan_cache;   //  most recently used last
+
+   //
+   //  number of callers still using each plan returned by
+   //  get_regrid_plan(), and the plans dropped from the cache which
+   //  are deleted once they are released
+   //
+
+static map<const RegridPlan *, int> plan_users;
+
+static vector<RegridPlan *> retired_plans;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static const RegridPlan * find_regrid_plan (const Grid &, const Grid &, RegridPlanType);
+
+static void drop_regrid_plan (RegridPlan *);
+
+static ConcatString regrid_plan_key    (const Grid &, const Grid &, RegridPlanType);
+static ConcatString regrid_plan_path   (const ConcatString & dir, const ConcatString & key);
+static long long    regrid_plan_values (const Grid &, const Grid &, RegridPlanType);
+static ConcatString grid_corner_string (const Grid &);
+
+static bool read_block  (ifstream &, void *, long long);
+static bool write_block (ofstream &, const void *, long long);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for class RegridPlan
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+RegridPlan::RegridPlan()
+
+{
+
+init_from_scratch();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+RegridPlan::~RegridPlan()
+
+{
+
+clear();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+RegridPlan::RegridPlan(const RegridPlan & p)
+
+{
+
+init_from_scratch();
+
+assign(p);
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+RegridPlan & RegridPlan::operator=(const RegridPlan & p)
+
+{
+
+if ( this == &p )  return ( * this );
+
+assign(p);
+
+return ( * this );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void RegridPlan::init_from_scratch()
+
+{
+
+clear();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void RegridPlan::clear()
+
+{
+
+Type = RegridPlanType_None;
+
+FromGrid.clear();
+ToGrid.clear();
+
+NSub = 0;
+
+X.clear();
+Y.clear();
+
+Index.clear();
+Area.clear();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void RegridPlan::assign(const RegridPlan & p)
+
+{
+
+clear();
+
+Type     = p.Type;
+
+FromGrid = p.FromGrid;
+ToGrid   = p.ToGrid;
+
+NSub     = p.NSub;
+
+X        = p.X;
+Y        = p.Y;
+
+Index    = p.Index;
+Area     = p.Area;
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void RegridPlan::dump(ostream & out, int depth) const
+
+{
+
+Indent prefix(depth);
+
+out << prefix << "Type     = " << regridplantype_to_string(Type) << "\n";
+out << prefix << "FromGrid = " << FromGrid.serialize() << "\n";
+out << prefix << "ToGrid   = " << ToGrid.serialize() << "\n";
+out << prefix << "NSub     = " << NSub << "\n";
+out << prefix << "NValues  = " << n_values() << "\n";
+
+out.flush();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+long long RegridPlan::n_values() const
+
+{
+
+long long n = (long long) X.size() + (long long) Y.size() +
+              (long long) Index.size() + (long long) Area.size();
+
+return ( n );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+ConcatString RegridPlan::key() const
+
+{
+
+return ( regrid_plan_key(FromGrid, ToGrid, Type) );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool RegridPlan::matches(const Grid & from_grid, const Grid & to_grid, RegridPlanType t) const
+
+{
+
+return ( Type == t && FromGrid == from_grid && ToGrid == to_grid );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void RegridPlan::build(const Grid & from_grid, const Grid & to_grid, RegridPlanType t)
+
+{
+
+int i, j, n;
+int xt, yt, xf, yf;
+double lat, lon, x_to, y_to, dxt, dyt;
+
+clear();
+
+Type     = t;
+FromGrid = from_grid;
+ToGrid   = to_grid;
+
+const int to_nx   = to_grid.nx();
+const int to_ny   = to_grid.ny();
+const int from_nx = from_grid.nx();
+const int from_ny = from_grid.ny();
+
+switch ( Type )  {
+
+   case RegridPlanType_Point:
+
+      NSub = 1;
+
+      X.resize(to_nx*to_ny);
+      Y.resize(to_nx*to_ny);
+
+      for (yt=0; yt<to_ny; ++yt)  {
+
+         for (xt=0; xt<to_nx; ++xt)  {
+
+            n = yt*to_nx + xt;
+
+            to_grid.xy_to_latlon(xt, yt, lat, lon);
+
+            from_grid.latlon_to_xy(lat, lon, X[n], Y[n]);
+
+         }   //  for xt
+
+      }   //  for yt
+
+      break;
+
+   case RegridPlanType_Budget:
+
+      {
+
+         const int N = 2*regrid_budget_radius + 1;
+         const double delta = 1.0/N;
+
+         NSub = N*N;
+
+         X.resize(to_nx*to_ny*NSub);
+         Y.resize(to_nx*to_ny*NSub);
+
+            //
+            //  sub-points are stored in the same order they are
+            //  summed by met_regrid_budget()
+            //
+
+         for (yt=0; yt<to_ny; ++yt)  {
+
+            for (xt=0; xt<to_nx; ++xt)  {
+
+               n = (yt*to_nx + xt)*NSub;
+
+               for (i=-regrid_budget_radius; i<=regrid_budget_radius; ++i)  {
+
+                  dxt = xt + i*delta;
+
+                  for (j=-regrid_budget_radius; j<=regrid_budget_radius; ++j)  {
+
+                     dyt = yt + j*delta;
+
+                     to_grid.xy_to_latlon(dxt, dyt, lat, lon);
+
+                     from_grid.latlon_to_xy(lat, lon, X[n], Y[n]);
+
+                     ++n;
+
+                  }   //  for j
+
+               }   //  for i
+
+            }   //  for xt
+
+         }   //  for yt
+
+      }
+
+      break;
+
+   case RegridPlanType_Area:
+
+      NSub = 1;
+
+      Index.resize(from_nx*from_ny);
+      Area.resize(from_nx*from_ny);
+
+      for (yf=0; yf<from_ny; ++yf)  {
+
+         for (xf=0; xf<from_nx; ++xf)  {
+
+            n = yf*from_nx + xf;
+
+            from_grid.xy_to_latlon(xf, yf, lat, lon);
+
+            to_grid.latlon_to_xy(lat, lon, x_to, y_to);
+
+            xt = nint(x_to);
+            yt = nint(y_to);
+
+            if ( (xt < 0) || (xt >= to_nx) || (yt < 0) || (yt >= to_ny) )  {
+
+               Index[n] = -1;
+               Area[n]  = 0.0;
+
+            } else {
+
+               Index[n] = yt*to_nx + xt;
+               Area[n]  = from_grid.calc_area(xf, yf);
+
+            }
+
+         }   //  for xf
+
+      }   //  for yf
+
+      break;
+
+   default:
+      mlog << Error << "\nRegridPlan::build() -> "
+           << "unexpected plan type ... "
+           << regridplantype_to_string(Type) << "\n\n";
+      exit(1);
+      break;
+
+}   //  switch Type
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool RegridPlan::read(const char * path, const Grid & from_grid, const Grid & to_grid, RegridPlanType t)
+
+{
+
+ifstream in;
+char magic[sizeof(regrid_plan_magic)];
+int version, key_len, type_int, nsub;
+long long n_x, n_y, n_index, n_area;
+ConcatString key, file_key;
+vector<char> key_buf;
+
+clear();
+
+in.open(path, ios::in | ios::binary);
+
+if ( !in )  return ( false );
+
+key = regrid_plan_key(from_grid, to_grid, t);
+
+   //
+   //  header
+   //
+
+if ( !read_block(in, magic, sizeof(magic))          ||
+     strncmp(magic, regrid_plan_magic, sizeof(magic)) ||
+     !read_block(in, &version, sizeof(version))     ||
+     version != regrid_plan_version                  ||
+     !read_block(in, &key_len, sizeof(key_len))     ||
+     key_len != (int) key.length() )  {
+
+   mlog << Debug(regrid_plan_debug_level)
+        << "RegridPlan::read() -> ignoring stale regrid plan file \""
+        << path << "\"\n";
+
+   return ( false );
+
+}
+
+key_buf.resize(key_len + 1, '\0');
+
+if ( !read_block(in, key_buf.data(), key_len) )  return ( false );
+
+file_key = key_buf.data();
+
+if ( file_key != key )  {
+
+   mlog << Debug(regrid_plan_debug_level)
+        << "RegridPlan::read() -> regrid plan file \"" << path
+        << "\" was built for different grids\n";
+
+   return ( false );
+
+}
+
+if ( !read_block(in, &type_int, sizeof(type_int)) ||
+     !read_block(in, &nsub,     sizeof(nsub))     ||
+     !read_block(in, &n_x,      sizeof(n_x))      ||
+     !read_block(in, &n_y,      sizeof(n_y))      ||
+     !read_block(in, &n_index,  sizeof(n_index))  ||
+     !read_block(in, &n_area,   sizeof(n_area)) )  return ( false );
+
+if ( type_int != (int) t ||
+     n_x + n_y + n_index + n_area != regrid_plan_values(from_grid, to_grid, t) )  {
+
+   mlog << Debug(regrid_plan_debug_level)
+        << "RegridPlan::read() -> regrid plan file \"" << path
+        << "\" has unexpected dimensions\n";
+
+   return ( false );
+
+}
+
+   //
+   //  data
+   //
+
+X.resize(n_x);
+Y.resize(n_y);
+Index.resize(n_index);
+Area.resize(n_area);
+
+if ( !read_block(in, X.data(),     n_x*sizeof(double))    ||
+     !read_block(in, Y.data(),     n_y*sizeof(double))    ||
+     !read_block(in, Index.data(), n_index*sizeof(int))   ||
+     !read_block(in, Area.data(),  n_area*sizeof(double)) )  {
+
+   mlog << Warning << "\nRegridPlan::read() -> "
+        << "trouble reading regrid plan file \"" << path << "\"\n\n";
+
+   clear();
+
+   return ( false );
+
+}
+
+in.close();
+
+Type     = t;
+FromGrid = from_grid;
+ToGrid   = to_grid;
+NSub     = nsub;
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool RegridPlan::write(const char * path) const
+
+{
+
+ofstream out;
+ConcatString tmp_path, cs;
+int key_len, type_int;
+long long n_x, n_y, n_index, n_area;
+const ConcatString k = key();
+
+   //
+   //  write to a temporary file and rename it so that concurrent runs
+   //  never read a partial plan
+   //
+
+tmp_path << path << ".tmp." << (int) getpid();
+
+out.open(tmp_path.c_str(), ios::out | ios::binary);
+
+if ( !out )  {
+
+   mlog << Warning << "\nRegridPlan::write() -> "
+        << "unable to open regrid plan file \"" << tmp_path << "\"\n\n";
+
+   return ( false );
+
+}
+
+key_len  = k.length();
+type_int = (int) Type;
+n_x      = X.size();
+n_y      = Y.size();
+n_index  = Index.size();
+n_area   = Area.size();
+
+if ( !write_block(out, regrid_plan_magic, sizeof(regrid_plan_magic)) ||
+     !write_block(out, &regrid_plan_version, sizeof(regrid_plan_version)) ||
+     !write_block(out, &key_len, sizeof(key_len))   ||
+     !write_block(out, k.c_str(), key_len)          ||
+     !write_block(out, &type_int, sizeof(type_int)) ||
+     !write_block(out, &NSub, sizeof(NSub))         ||
+     !write_block(out, &n_x, sizeof(n_x))           ||
+     !write_block(out, &n_y, sizeof(n_y))           ||
+     !write_block(out, &n_index, sizeof(n_index))   ||
+     !write_block(out, &n_area, sizeof(n_area))     ||
+     !write_block(out, X.data(), n_x*sizeof(double))       ||
+     !write_block(out, Y.data(), n_y*sizeof(double))       ||
+     !write_block(out, Index.data(), n_index*sizeof(int))  ||
+     !write_block(out, Area.data(), n_area*sizeof(double)) )  {
+
+   mlog << Warning << "\nRegridPlan::write() -> "
+        << "trouble writing regrid plan file \"" << tmp_path << "\"\n\n";
+
+   out.close();
+   remove(tmp_path.c_str());
+
+   return ( false );
+
+}
+
+out.close();
+
+if ( rename(tmp_path.c_str(), path) != 0 )  {
+
+   mlog << Warning << "\nRegridPlan::write() -> "
+        << "unable to rename \"" << tmp_path << "\" to \""
+        << path << "\"\n\n";
+
+   remove(tmp_path.c_str());
+
+   return ( false );
+
+}
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for misc functions
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+const RegridPlan * get_regrid_plan(const Grid & from_grid, const Grid & to_grid, RegridPlanType t)
+
+{
+
+const RegridPlan * plan = (const RegridPlan *) 0;
+
+   //
+   //  fields may be regridded concurrently, so only one thread
+   //  searches or updates the cache at a time
+   //
+
+   //
+   //  the plan is checked out until release_regrid_plan() is called,
+   //  so that it is not deleted while another thread is using it
+   //
+
+#pragma omp critical(met_regrid_plan)
+{
+
+plan = find_regrid_plan(from_grid, to_grid, t);
+
+if ( plan )  plan_users[plan]++;
+
+}
+
+return ( plan );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void release_regrid_plan(const RegridPlan * plan)
+
+{
+
+if ( !plan )  return;
+
+#pragma omp critical(met_regrid_plan)
+{
+
+map<const RegridPlan *, int>::iterator it = plan_users.find(plan);
+
+if ( it != plan_users.end() && --(it->second) <= 0 )  {
+
+   plan_users.erase(it);
+
+      //
+      //  delete it now if it was dropped from the cache while in use
+      //
+
+   for (int j=0; j<(int) retired_plans.size(); ++j)  {
+
+      if ( retired_plans[j] == plan )  {
+
+         delete retired_plans[j];
+
+         retired_plans.erase(retired_plans.begin() + j);
+
+         break;
+
+      }
+
+   }
+
+}
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void drop_regrid_plan(RegridPlan * plan)
+
+{
+
+   //
+   //  called inside the met_regrid_plan critical section
+   //
+
+if ( plan_users.count(plan) > 0 )  retired_plans.push_back(plan);
+else                               delete plan;
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+const RegridPlan * find_regrid_plan(const Grid & from_grid, const Grid & to_grid, RegridPlanType t)
+
+{
+
+int j;
+RegridPlan * plan = (RegridPlan *) 0;
+ConcatString dir, path;
+bool status = false;
+
+   //
+   //  grids which cannot be compared are never cached
+   //
+
+if ( !(from_grid == from_grid) || !(to_grid == to_grid) )  return ( 0 );
+
+   //
+   //  search the cache
+   //
+
+for (j=(int) plan_cache.size() - 1; j>=0; --j)  {
+
+   if ( plan_cache[j]->matches(from_grid, to_grid, t) )  {
+
+      plan = plan_cache[j];
+
+      plan_cache.erase(plan_cache.begin() + j);
+      plan_cache.push_back(plan);
+
+      return ( plan );
+
+   }
+
+}
+
+   //
+   //  skip plans which are too large to keep in memory
+   //
+
+if ( regrid_plan_values(from_grid, to_grid, t) > regrid_plan_max_values )  {
+
+   mlog << Debug(regrid_plan_debug_level)
+        << "get_regrid_plan() -> not caching the "
+        << regridplantype_to_string(t) << " regrid plan since it "
+        << "exceeds " << regrid_plan_max_values << " values.\n";
+
+   return ( 0 );
+
+}
+
+plan = new RegridPlan;
+
+   //
+   //  try reading the plan from disk
+   //
+
+if ( get_env(regrid_plan_dir_env, dir) && dir.nonempty() )  {
+
+   path = regrid_plan_path(dir, regrid_plan_key(from_grid, to_grid, t));
+
+   if ( file_exists(path.c_str()) )  {
+
+      status = plan->read(path.c_str(), from_grid, to_grid, t);
+
+      if ( status )  {
+         mlog << Debug(regrid_plan_debug_level)
+              << "Reading " << regridplantype_to_string(t)
+              << " regrid plan file: " << path << "\n";
+      }
+
+   }
+
+}
+
+   //
+   //  otherwise build it and write it to disk, if requested
+   //
+
+if ( !status )  {
+
+   mlog << Debug(regrid_plan_debug_level)
+        << "Building " << regridplantype_to_string(t)
+        << " regrid plan from " << from_grid.name() << " ("
+        << from_grid.nx() << " x " << from_grid.ny() << ") to "
+        << to_grid.name() << " (" << to_grid.nx() << " x "
+        << to_grid.ny() << ").\n";
+
+   plan->build(from_grid, to_grid, t);
+
+   if ( path.nonempty() && plan->write(path.c_str()) )  {
+      mlog << Debug(regrid_plan_debug_level)
+           << "Writing " << regridplantype_to_string(t)
+           << " regrid plan file: " << path << "\n";
+   }
+
+}
+
+   //
+   //  add it to the cache, dropping the least recently used
+   //
+
+plan_cache.push_back(plan);
+
+if ( (int) plan_cache.size() > regrid_plan_cache_size )  {
+
+   drop_regrid_plan(plan_cache.front());
+
+   plan_cache.erase(plan_cache.begin());
+
+}
+
+return ( plan );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void clear_regrid_plan_cache()
+
+{
+
+int j;
+
+#pragma omp critical(met_regrid_plan)
+{
+
+for (j=0; j<(int) plan_cache.size(); ++j)  {
+
+   drop_regrid_plan(plan_cache[j]);  plan_cache[j] = (RegridPlan *) 0;
+
+}
+
+plan_cache.clear();
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+ConcatString regridplantype_to_string(RegridPlanType t)
+
+{
+
+ConcatString s;
+
+switch ( t )  {
+
+   case RegridPlanType_None:   s = "None";    break;
+   case RegridPlanType_Point:  s = "Point";   break;
+   case RegridPlanType_Budget: s = "Budget";  break;
+   case RegridPlanType_Area:   s = "Area";    break;
+
+   default:                    s = "(bad value)";  break;
+
+}
+
+return ( s );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+ConcatString regrid_plan_key(const Grid & from_grid, const Grid & to_grid, RegridPlanType t)
+
+{
+
+ConcatString key;
+
+key << "type: " << regridplantype_to_string(t)
+    << " budget_radius: " << regrid_budget_radius << "\n"
+    << "from: " << from_grid.serialize() << grid_corner_string(from_grid) << "\n"
+    << "to: "   << to_grid.serialize()   << grid_corner_string(to_grid)   << "\n";
+
+return ( key );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+ConcatString regrid_plan_path(const ConcatString & dir, const ConcatString & key)
+
+{
+
+ConcatString path;
+char junk[64];
+unsigned long long h = 14695981039346656037ULL;
+int j;
+
+   //
+   //  64-bit FNV-1a hash of the plan key
+   //
+
+for (j=0; j<(int) key.length(); ++j)  {
+
+   h ^= (unsigned char) key.c_str()[j];
+   h *= 1099511628211ULL;
+
+}
+
+snprintf(junk, sizeof(junk), "regrid_plan_%016llx.bin", h);
+
+path << dir << "/" << junk;
+
+return ( path );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+long long regrid_plan_values(const Grid & from_grid, const Grid & to_grid, RegridPlanType t)
+
+{
+
+const long long N = 2*regrid_budget_radius + 1;
+long long n = 0;
+
+switch ( t )  {
+
+   case RegridPlanType_Point:  n = 2*((long long) to_grid.nxy());        break;
+   case RegridPlanType_Budget: n = 2*((long long) to_grid.nxy())*N*N;    break;
+   case RegridPlanType_Area:   n = 2*((long long) from_grid.nxy());      break;
+   default:                    n = 0;                                    break;
+
+}
+
+return ( n );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Grid::serialize() rounds the projection parameters, so append
+   //  the corner locations at full precision to distinguish grids
+   //
+
+ConcatString grid_corner_string(const Grid & g)
+
+{
+
+ConcatString cs;
+char junk[256];
+double lat_ll, lon_ll, lat_ur, lon_ur;
+
+g.xy_to_latlon(0.0, 0.0, lat_ll, lon_ll);
+g.xy_to_latlon(g.nx() - 1.0, g.ny() - 1.0, lat_ur, lon_ur);
+
+snprintf(junk, sizeof(junk), " Corners: %.8f %.8f %.8f %.8f",
+         lat_ll, lon_ll, lat_ur, lon_ur);
+
+cs << junk;
+
+return ( cs );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool read_block(ifstream & in, void * buf, long long n_bytes)
+
+{
+
+if ( n_bytes <= 0 )  return ( true );
+
+in.read((char *) buf, n_bytes);
+
+return ( in.gcount() == n_bytes );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool write_block(ofstream & out, const void * buf, long long n_bytes)
+
+{
+
+if ( n_bytes <= 0 )  return ( true );
+
+out.write((const char *) buf, n_bytes);
+
+return ( !(!out) );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
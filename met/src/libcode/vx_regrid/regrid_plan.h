@@ -0,0 +1,190 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifndef  __MET_REGRID_PLAN_H__
+#define  __MET_REGRID_PLAN_H__
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#include <vector>
+
+#include "vx_grid.h"
+#include "vx_log.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  A regrid plan stores the result of the projection math
+   //  relating two grids so that it can be reused for every field
+   //  regridded between them.
+   //
+
+enum RegridPlanType {
+
+   RegridPlanType_None,
+
+   RegridPlanType_Point,    //  from grid (x, y) for each to grid point
+   RegridPlanType_Budget,   //  from grid (x, y) for each budget sub-point
+   RegridPlanType_Area      //  to grid index and area for each from grid point
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Hard-coded radius for budget interpolation
+   //
+
+static const int regrid_budget_radius = 2;
+
+   //
+   //  Number of plans kept in memory and the largest plan to be cached,
+   //  in number of stored values
+   //
+
+static const int regrid_plan_cache_size = 4;
+
+static const long long regrid_plan_max_values = 100000000;
+
+   //
+   //  Environment variable naming a directory in which regrid plans are
+   //  stored and reused across runs
+   //
+
+static const char regrid_plan_dir_env [] = "MET_REGRID_PLAN_DIR";
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+class RegridPlan {
+
+   private:
+
+      void init_from_scratch();
+
+      void assign(const RegridPlan &);
+
+      RegridPlanType Type;
+
+      Grid FromGrid;
+      Grid ToGrid;
+
+      int NSub;     //  number of from grid locations per to grid point
+
+      std::vector<double> X;       //  from grid x, Point and Budget types
+      std::vector<double> Y;       //  from grid y, Point and Budget types
+
+      std::vector<int>    Index;   //  to grid index, Area type
+      std::vector<double> Area;    //  from grid box area, Area type
+
+   public:
+
+      RegridPlan();
+     ~RegridPlan();
+      RegridPlan(const RegridPlan &);
+      RegridPlan & operator=(const RegridPlan &);
+
+      void clear();
+
+      void dump(ostream &, int = 0) const;
+
+         //
+         //  set stuff
+         //
+
+      void build(const Grid & from_grid, const Grid & to_grid, RegridPlanType);
+
+      bool read  (const char * path, const Grid & from_grid, const Grid & to_grid, RegridPlanType);
+      bool write (const char * path) const;
+
+         //
+         //  get stuff
+         //
+
+      RegridPlanType type() const;
+
+      int n_sub() const;
+
+      long long n_values() const;
+
+      const Grid & from_grid() const;
+      const Grid & to_grid()   const;
+
+      double x(int) const;
+      double y(int) const;
+
+      int    index(int) const;
+      double area(int)  const;
+
+      ConcatString key() const;
+
+         //
+         //  do stuff
+         //
+
+      bool matches(const Grid & from_grid, const Grid & to_grid, RegridPlanType) const;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+inline RegridPlanType RegridPlan::type() const { return ( Type ); }
+
+inline int RegridPlan::n_sub() const { return ( NSub ); }
+
+inline const Grid & RegridPlan::from_grid() const { return ( FromGrid ); }
+inline const Grid & RegridPlan::to_grid()   const { return ( ToGrid   ); }
+
+inline double RegridPlan::x(int n) const { return ( X[n] ); }
+inline double RegridPlan::y(int n) const { return ( Y[n] ); }
+
+inline int    RegridPlan::index(int n) const { return ( Index[n] ); }
+inline double RegridPlan::area(int n)  const { return ( Area[n]  ); }
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Look up a plan in the in-memory cache, reading it from or writing
+   //  it to the MET_REGRID_PLAN_DIR directory when that is set.
+   //  Returns 0 when the plan should not be cached, in which case the
+   //  caller does the projection math itself.  Each plan returned
+   //  must be passed to release_regrid_plan() when the caller is done.
+   //
+
+extern const RegridPlan * get_regrid_plan(const Grid & from_grid, const Grid & to_grid, RegridPlanType);
+
+extern void release_regrid_plan(const RegridPlan *);
+
+extern void clear_regrid_plan_cache();
+
+extern ConcatString regridplantype_to_string(RegridPlanType);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#endif   /*  __MET_REGRID_PLAN_H__  */
+
+
+////////////////////////////////////////////////////////////////////////
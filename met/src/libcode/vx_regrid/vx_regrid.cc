@@ -13,6 +13,9 @@
 
 using namespace std;
 
+#include <algorithm>
+#include <vector>
+
 #include "vx_regrid.h"
 
 #include "interp_mthd.h"
@@ -20,6 +23,24 @@ using namespace std;
 #include "GridTemplate.h"
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Number of from grid columns processed per block when regridding
+   //  using the area-weighted mean without a regrid plan
+   //
+
+static const int regrid_aw_block_size = 64;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static void regrid_points (const DataPlane &, const Grid &, const Grid &,
+                           const InterpMthd, const RegridInfo &, DataPlane &);
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -114,52 +135,9 @@ DataPlane met_regrid_generic (const DataPlane & from_data, const Grid & from_gri
 
 {
 
-int xt, yt;
-int xf, yf;
-double value, lat, lon;
-double x_from, y_from;
 DataPlane to_data;
 
-to_data.set_size(to_grid.nx(), to_grid.ny());
-
-   //
-   //  copy timing info
-   //
-
-to_data.set_init  (from_data.init());
-to_data.set_valid (from_data.valid());
-to_data.set_lead  (from_data.lead());
-to_data.set_accum (from_data.accum());
-
-   //
-   //  copy data
-   //
-for (xt=0; xt<(to_grid.nx()); ++xt)  {
-
-   for (yt=0; yt<(to_grid.ny()); ++yt)  {
-
-      to_grid.xy_to_latlon(xt, yt, lat, lon);
-
-      from_grid.latlon_to_xy(lat, lon, x_from, y_from);
-
-      xf = nint(x_from);
-      yf = nint(y_from);
-
-      if ( (xf < 0) || (xf >= from_grid.nx()) || (yf < 0) || (yf >= from_grid.ny()) )  {
-
-         value = bad_data_float;
-
-      } else {
-         value = compute_horz_interp(from_data, x_from, y_from, bad_data_double,
-                                     info.method, info.width, info.shape, info.vld_thresh);
-
-      }
-
-      to_data.put(value, xt, yt);
-
-   }   //  for yt
-
-}   //  for xt
+regrid_points(from_data, from_grid, to_grid, info.method, info, to_data);
 
    //
    //  done
@@ -177,11 +155,16 @@ DataPlane met_regrid_area_weighted (const DataPlane & from_data, const Grid & fr
 
 {
 
-int xt, yt;
-int xf, yf;
-double value, weight, lat, lon;
-double x_to, y_to;
+int xf, yf, x_beg, x_end, n;
+double value, weight;
 DataPlane to_data, wt_data;
+vector<int> to_index;
+vector<double> to_area;
+const int to_nx   = to_grid.nx();
+const int to_ny   = to_grid.ny();
+const int from_nx = from_grid.nx();
+const int from_ny = from_grid.ny();
+const RegridPlan * plan = get_regrid_plan(from_grid, to_grid, RegridPlanType_Area);
 
    //
    //  The interpolation width and shape do not apply here.  The output
@@ -194,8 +177,8 @@ DataPlane to_data, wt_data;
    //  set output size and initialize to 0
    //
 
-to_data.set_size(to_grid.nx(), to_grid.ny());
-wt_data.set_size(to_grid.nx(), to_grid.ny());
+to_data.set_size(to_nx, to_ny);
+wt_data.set_size(to_nx, to_ny);
 
 to_data.set_constant(0.0);
 wt_data.set_constant(0.0);
@@ -210,59 +193,95 @@ to_data.set_lead  (from_data.lead());
 to_data.set_accum (from_data.accum());
 
    //
-   //  loop over the from grid to accumulate sums and area weights
+   //  loop over blocks of from grid columns.  Without a regrid plan,
+   //  the to grid locations for each block are computed in parallel.
+   //  The sums are then accumulated serially, in the same order as
+   //  always, so that the output does not depend on the thread count.
    //
 
-for (xf=0; xf<(from_grid.nx()); ++xf)  {
+if ( !plan )  {
+   to_index.resize(regrid_aw_block_size*from_ny);
+   to_area.resize(regrid_aw_block_size*from_ny);
+}
 
-   for (yf=0; yf<(from_grid.ny()); ++yf)  {
+for (x_beg=0; x_beg<from_nx; x_beg+=regrid_aw_block_size)  {
 
-      from_grid.xy_to_latlon(xf, yf, lat, lon);
+   x_end = min(x_beg + regrid_aw_block_size, from_nx);
 
-      to_grid.latlon_to_xy(lat, lon, x_to, y_to);
+   if ( !plan )  {
 
-      xt = nint(x_to);
-      yt = nint(y_to);
+#pragma omp parallel for schedule(static)
+      for (xf=x_beg; xf<x_end; ++xf)  {
 
-      if ( (xt < 0) || (xt >= to_grid.nx()) || (yt < 0) || (yt >= to_grid.ny()) )  {
+         int yf, xt, yt, k;
+         double lat, lon, x_to, y_to;
 
-         continue;
+         for (yf=0; yf<from_ny; ++yf)  {
 
-      } else {
+            k = (xf - x_beg)*from_ny + yf;
 
-         if ( is_bad_data(value = from_data(xf, yf)) )  continue;
-         weight = from_grid.calc_area(xf, yf);
+            from_grid.xy_to_latlon(xf, yf, lat, lon);
 
-         to_data.set(to_data(xt, yt) + value*weight, xt, yt);
-         wt_data.set(wt_data(xt, yt) + weight,       xt, yt);
+            to_grid.latlon_to_xy(lat, lon, x_to, y_to);
 
-      }
+            xt = nint(x_to);
+            yt = nint(y_to);
 
-   }   //  for yf
+            if ( (xt < 0) || (xt >= to_nx) || (yt < 0) || (yt >= to_ny) )  {
+               to_index[k] = -1;
+               to_area[k]  = 0.0;
+            } else {
+               to_index[k] = yt*to_nx + xt;
+               to_area[k]  = from_grid.calc_area(xf, yf);
+            }
 
-}   //  for xf
+         }   //  for yf
 
-   //
-   //  loop over the to grid to compute the area weighted average
-   //
+      }   //  for xf
 
-for (xt=0; xt<(to_grid.nx()); ++xt)  {
+   }
 
-   for (yt=0; yt<(to_grid.ny()); ++yt)  {
+   for (xf=x_beg; xf<x_end; ++xf)  {
 
-      if ( is_eq(wt_data(xt, yt), 0.0) )  {
+      for (yf=0; yf<from_ny; ++yf)  {
 
-         to_data.set(bad_data_double, xt, yt);
+         if ( plan )  {
+            n      = plan->index(yf*from_nx + xf);
+            weight = plan->area(yf*from_nx + xf);
+         } else {
+            n      = to_index[(xf - x_beg)*from_ny + yf];
+            weight = to_area[(xf - x_beg)*from_ny + yf];
+         }
 
-      } else {
+         if ( n < 0 )  continue;
+
+         if ( is_bad_data(value = from_data(xf, yf)) )  continue;
 
-         to_data.set(to_data(xt, yt) / wt_data(xt, yt), xt, yt);
+         to_data.buf()[n] += value*weight;
+         wt_data.buf()[n] += weight;
 
-      }
+      }   //  for yf
+
+   }   //  for xf
+
+}   //  for x_beg
+
+release_regrid_plan(plan);
+
+   //
+   //  loop over the to grid to compute the area weighted average
+   //
 
-   }   //  for yt
+vector<double> & to_buf = to_data.buf();
+const vector<double> & wt_buf = wt_data.buf();
 
-}   //  for xt
+#pragma omp parallel for schedule(static)
+for (n=0; n<to_nx*to_ny; ++n)  {
+
+   if ( is_eq(wt_buf[n], 0.0) )  to_buf[n] = bad_data_double;
+   else                          to_buf[n] = to_buf[n] / wt_buf[n];
+
+}   //  for n
 
    //
    //  done
@@ -308,13 +327,39 @@ DataPlane met_regrid_maxgauss (const DataPlane & from_data, const Grid & from_gr
 
 {
 
-int xt, yt;
-int xf, yf;
-double value, lat, lon;
-double x_from, y_from;
 DataPlane to_data;
 
-to_data.set_size(to_grid.nx(), to_grid.ny());
+regrid_points(from_data, from_grid, to_grid, InterpMthd_Max, info, to_data);
+
+interp_gaussian_dp(to_data, info.gaussian, info.vld_thresh);
+
+return ( to_data );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Interpolate the from grid data to each to grid point.  The rows
+   //  of the to grid are processed in parallel, each written in
+   //  memory order.
+   //
+
+void regrid_points (const DataPlane & from_data, const Grid & from_grid, const Grid & to_grid,
+                    const InterpMthd method, const RegridInfo & info, DataPlane & to_data)
+
+{
+
+int yt;
+const int to_nx   = to_grid.nx();
+const int to_ny   = to_grid.ny();
+const int from_nx = from_grid.nx();
+const int from_ny = from_grid.ny();
+const RegridPlan * plan = get_regrid_plan(from_grid, to_grid, RegridPlanType_Point);
+
+to_data.set_size(to_nx, to_ny);
 
    //
    //  copy timing info
@@ -328,37 +373,52 @@ to_data.set_accum (from_data.accum());
    //
    //  copy data
    //
-for (xt=0; xt<(to_grid.nx()); ++xt)  {
 
-   for (yt=0; yt<(to_grid.ny()); ++yt)  {
+#pragma omp parallel for schedule(dynamic, 1)
+for (yt=0; yt<to_ny; ++yt)  {
+
+   int xt, xf, yf;
+   double value, lat, lon;
+   double x_from, y_from;
 
-      to_grid.xy_to_latlon(xt, yt, lat, lon);
+   for (xt=0; xt<to_nx; ++xt)  {
 
-      from_grid.latlon_to_xy(lat, lon, x_from, y_from);
+      if ( plan )  {
+
+         x_from = plan->x(yt*to_nx + xt);
+         y_from = plan->y(yt*to_nx + xt);
+
+      } else {
+
+         to_grid.xy_to_latlon(xt, yt, lat, lon);
+
+         from_grid.latlon_to_xy(lat, lon, x_from, y_from);
+
+      }
 
       xf = nint(x_from);
       yf = nint(y_from);
 
-      if ( (xf < 0) || (xf >= from_grid.nx()) ||
-           (yf < 0) || (yf >= from_grid.ny()) )  {
+      if ( (xf < 0) || (xf >= from_nx) || (yf < 0) || (yf >= from_ny) )  {
 
          value = bad_data_float;
 
       } else {
-         value = compute_horz_interp(from_data, x_from, y_from,
-                    bad_data_double, InterpMthd_Max, info.width,
-                    info.shape, info.vld_thresh);
+
+         value = compute_horz_interp(from_data, x_from, y_from, bad_data_double,
+                                     method, info.width, info.shape, info.vld_thresh);
+
       }
 
       to_data.put(value, xt, yt);
 
-   }   //  for yt
+   }   //  for xt
 
-}   //  for xt
+}   //  for yt
 
-interp_gaussian_dp(to_data, info.gaussian, info.vld_thresh);
+release_regrid_plan(plan);
 
-return ( to_data );
+return;
 
 }
 
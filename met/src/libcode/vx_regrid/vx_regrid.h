@@ -22,6 +22,8 @@
 #include "data_plane.h"
 #include "config_constants.h"
 
+#include "regrid_plan.h"
+
 
 ////////////////////////////////////////////////////////////////////////
 
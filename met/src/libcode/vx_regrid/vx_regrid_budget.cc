@@ -26,23 +26,22 @@ DataPlane met_regrid_budget (const DataPlane & from_data, const Grid & from_grid
 {
 
 DataPlane to_data;
-int i, j, ixt, iyt;
-int count;
-double dxt, dyt, dxf, dyf;
-double sum, lat, lon, value;
-double fraction;
+int iyt;
+const RegridPlan * plan = get_regrid_plan(from_grid, to_grid, RegridPlanType_Budget);
 
    //
    //  Hard-code the radius for budget interpolation.
    //  Consider making this configurable.
    //
 
-const int Radius = 2;
+const int Radius = regrid_budget_radius;
 const int N = 2*Radius + 1;
 const int NN = N*N;
 const double delta = 1.0/N;
+const int to_nx = to_grid.nx();
+const int to_ny = to_grid.ny();
 
-to_data.set_size(to_grid.nx(), to_grid.ny());
+to_data.set_size(to_nx, to_ny);
 
    //
    // Copy timing info
@@ -54,28 +53,46 @@ to_data.set_lead  (from_data.lead());
 to_data.set_accum (from_data.accum());
 
    //
-   //  Do the interpolation
+   //  Do the interpolation, processing the rows in parallel
    //
 
-for (ixt=0; ixt<(to_grid.nx()); ++ixt)  {
+#pragma omp parallel for schedule(dynamic, 1)
+for (iyt=0; iyt<to_ny; ++iyt)  {
 
-   for (iyt=0; iyt<(to_grid.ny()); ++iyt)  {
+   int i, j, k, ixt;
+   int count;
+   double dxt, dyt, dxf, dyf;
+   double sum, lat, lon, value;
+   double fraction;
+
+   for (ixt=0; ixt<to_nx; ++ixt)  {
 
       sum = 0.0;
 
       count = 0;
 
+      k = (iyt*to_nx + ixt)*NN;
+
       for (i=-Radius; i<=Radius; ++i)  {
 
          dxt = ixt + i*delta;
 
-         for (j=-Radius; j<=Radius; ++j)  {
+         for (j=-Radius; j<=Radius; ++j, ++k)  {
 
             dyt = iyt + j*delta;
 
-            to_grid.xy_to_latlon(dxt, dyt, lat, lon);
+            if ( plan )  {
+
+               dxf = plan->x(k);
+               dyf = plan->y(k);
+
+            } else {
 
-            from_grid.latlon_to_xy(lat, lon, dxf, dyf);
+               to_grid.xy_to_latlon(dxt, dyt, lat, lon);
+
+               from_grid.latlon_to_xy(lat, lon, dxf, dyf);
+
+            }
 
             value = interp_bilin(from_data, dxf, dyf);
 
@@ -92,9 +109,11 @@ for (ixt=0; ixt<(to_grid.nx()); ++ixt)  {
 
       to_data.put(value, ixt, iyt);
 
-   }   //  for iyt
+   }   //  for ixt
+
+}   //  for iyt
 
-}   //  for ixt
+release_regrid_plan(plan);
 
 
    //
@@ -386,6 +386,91 @@ void ModeFuzzyEngine::set_obs_no_conv(const ShapeData &obs_wd) {
 ///////////////////////////////////////////////////////////////////////
 
 
+void ModeFuzzyEngine::set_with_conv(const ShapeData &fcst_wd, const ShapeData &obs_wd,
+                                    const ShapeData *fcst_conv_wd, const ShapeData *obs_conv_wd)
+
+{
+
+   ConcatString path;
+
+   clear_features();
+   clear_colors();
+   ctable.clear();
+
+   collection.clear();
+
+   if(fcst_conv_wd) set_fcst_with_conv(fcst_wd, *fcst_conv_wd);
+   else             set_fcst(fcst_wd);
+
+   if(obs_conv_wd)  set_obs_with_conv(obs_wd, *obs_conv_wd);
+   else             set_obs(obs_wd);
+
+   path = replace_path(conf_info.object_pi.color_table.c_str());
+
+   ctable.read(path.c_str());
+
+   return;
+
+}
+
+
+///////////////////////////////////////////////////////////////////////
+
+
+void ModeFuzzyEngine::set_fcst_with_conv(const ShapeData &fcst_wd,
+                                         const ShapeData &fcst_conv_wd)
+
+{
+
+   *fcst_raw  = fcst_wd;
+   *fcst_conv = fcst_conv_wd;
+
+   need_fcst_conv       = false;
+   need_fcst_thresh     = true;
+   need_fcst_filter     = true;
+   need_fcst_split      = true;
+   need_fcst_merge      = true;
+   need_fcst_clus_split = true;
+   need_match           = true;
+
+   do_fcst_thresholding();
+   do_fcst_filtering();
+   do_fcst_splitting();
+
+   return;
+}
+
+
+///////////////////////////////////////////////////////////////////////
+
+
+void ModeFuzzyEngine::set_obs_with_conv(const ShapeData &obs_wd,
+                                        const ShapeData &obs_conv_wd)
+
+{
+
+   *obs_raw  = obs_wd;
+   *obs_conv = obs_conv_wd;
+
+   need_obs_conv       = false;
+   need_obs_thresh     = true;
+   need_obs_filter     = true;
+   need_obs_split      = true;
+   need_obs_merge      = true;
+   need_obs_clus_split = true;
+   need_match          = true;
+
+   do_obs_thresholding();
+   do_obs_filtering();
+   do_obs_splitting();
+
+   return;
+}
+
+
+///////////////////////////////////////////////////////////////////////
+
+
 int ModeFuzzyEngine::two_to_one(int n_f, int n_o) const {
    int n;
 
@@ -897,40 +982,9 @@ void ModeFuzzyEngine::do_match_merge() {
    }
 
    //
-   // Do the pair features
+   // Do the pair features and interest values
    //
-   pair_single.set_size(n_fcst*n_obs);
-
-   for(j=0; j<n_fcst; j++) {
-      for(k=0; k<n_obs; k++) {
-
-         n = two_to_one(j, k);
-
-         pair_single[n].set(fcst_single[j], obs_single[k],
-                     conf_info.max_centroid_dist);
-         pair_single[n].pair_number = n;
-      }
-   }
-
-   //
-   // Calculate the interest values
-   //
-   info_singles.set_size(n_fcst*n_obs);
-
-   for(j=0; j<n_fcst; j++) {
-      for(k=0; k<n_obs; k++) {
-
-         n = two_to_one(j, k);
-
-         info_singles[n].fcst_number    = (j+1);
-         info_singles[n].obs_number     = (k+1);
-         info_singles[n].pair_number    = n;
-         info_singles[n].interest_value = total_interest(conf_info,
-                                             pair_single[n], j+1, k+1,
-                                             true);
-
-      }
-   }
+   do_pair_interest();
 
    //
    // Sort the interest values in decreasing order
@@ -1649,40 +1703,9 @@ void ModeFuzzyEngine::do_match_fcst_merge() {
    }
 
    //
-   // Do the pair features
+   // Do the pair features and interest values
    //
-   pair_single.set_size(n_fcst*n_obs);
-
-   for(j=0; j<n_fcst; j++) {
-      for(k=0; k<n_obs; k++) {
-
-         n = two_to_one(j, k);
-
-         pair_single[n].set(fcst_single[j], obs_single[k],
-                     conf_info.max_centroid_dist);
-         pair_single[n].pair_number = n;
-      }
-   }
-
-   //
-   // Calculate the interest values
-   //
-   info_singles.set_size(n_fcst*n_obs);
-
-   for(j=0; j<n_fcst; j++) {
-      for(k=0; k<n_obs; k++) {
-
-         n = two_to_one(j, k);
-
-         info_singles[n].fcst_number    = (j+1);
-         info_singles[n].obs_number     = (k+1);
-         info_singles[n].pair_number    = n;
-         info_singles[n].interest_value = total_interest(conf_info,
-                                             pair_single[n], j+1, k+1,
-                                             true);
-
-      }
-   }
+   do_pair_interest();
 
    //
    // Sort the interest values in decreasing order
@@ -1826,39 +1849,9 @@ void ModeFuzzyEngine::do_match_only() {
    }
 
    //
-   // Do the pair features
-   //
-   pair_single.set_size(n_fcst*n_obs);
-
-   for(j=0; j<n_fcst; j++) {
-      for(k=0; k<n_obs; k++) {
-
-         n = two_to_one(j, k);
-
-         pair_single[n].set(fcst_single[j], obs_single[k],
-                     conf_info.max_centroid_dist);
-         pair_single[n].pair_number = n;
-      }
-   }
-
-   //
-   // Calculate the interest values
+   // Do the pair features and interest values
    //
-   info_singles.set_size(n_fcst*n_obs);
-
-   for(j=0; j<n_fcst; j++) {
-      for(k=0; k<n_obs; k++) {
-
-         n = two_to_one(j, k);
-
-         info_singles[n].fcst_number    = (j+1);
-         info_singles[n].obs_number     = (k+1);
-         info_singles[n].pair_number    = n;
-         info_singles[n].interest_value = total_interest(conf_info,
-                                             pair_single[n], j+1, k+1,
-                                             true);
-      }
-   }
+   do_pair_interest();
 
    //
    // Sort the interest values in decreasing order
@@ -2029,6 +2022,48 @@ void ModeFuzzyEngine::do_obs_clus_splitting() {
 
 ///////////////////////////////////////////////////////////////////////
 
+void ModeFuzzyEngine::do_pair_interest() {
+   int i, j, k, n;
+   const int n_pair = n_fcst*n_obs;
+
+   //
+   // The pairs are independent, so split them among the threads and
+   // store each result at its pair index so that the matches do not
+   // depend on the number of threads.  Compute them serially when
+   // logging the interest values to keep the log for each pair
+   // together.
+   //
+   const bool log_interest =
+      (mlog.verbosity_level() >= print_interest_log_level);
+
+   pair_single.set_size(n_pair);
+   info_singles.set_size(n_pair);
+
+#pragma omp parallel for schedule(dynamic) private(j, k, n) \
+        if(!log_interest)
+   for(i=0; i<n_pair; i++) {
+
+      j = i/n_obs;
+      k = i%n_obs;
+      n = two_to_one(j, k);
+
+      pair_single[n].set(fcst_single[j], obs_single[k],
+                  conf_info.max_centroid_dist);
+      pair_single[n].pair_number = n;
+
+      info_singles[n].fcst_number    = (j+1);
+      info_singles[n].obs_number     = (k+1);
+      info_singles[n].pair_number    = n;
+      info_singles[n].interest_value = total_interest(conf_info,
+                                          pair_single[n], j+1, k+1,
+                                          true);
+   }
+
+   return;
+}
+
+///////////////////////////////////////////////////////////////////////
+
 void ModeFuzzyEngine::do_cluster_features() {
    int j;
    ShapeData * fcst_clus_shape = (ShapeData *) 0;
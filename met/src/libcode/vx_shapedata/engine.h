@@ -190,6 +190,17 @@ class ModeFuzzyEngine {
       void set_fcst_no_conv (const ShapeData & fcst_wd);
       void set_obs_no_conv  (const ShapeData &  obs_wd);
 
+         //
+         // Use the convolved fields passed in rather than convolving
+         // the raw fields, unless they're null
+         //
+
+      void set_with_conv(const ShapeData &fcst_wd, const ShapeData &obs_wd,
+                         const ShapeData *fcst_conv_wd, const ShapeData *obs_conv_wd);
+
+      void set_fcst_with_conv (const ShapeData & fcst_wd, const ShapeData & fcst_conv_wd);
+      void set_obs_with_conv  (const ShapeData &  obs_wd, const ShapeData &  obs_conv_wd);
+
       int two_to_one(int, int) const;
 
       void do_fcst_convolution();
@@ -263,6 +274,13 @@ class ModeFuzzyEngine {
 
       void do_cluster_features();
 
+         //
+         // Compute the pair features and total interest for each
+         // forecast and observation object pair
+         //
+
+      void do_pair_interest();
+
          //
          // Configuration information
          //
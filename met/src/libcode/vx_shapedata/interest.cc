@@ -38,6 +38,8 @@ static void get_percentiles(DistributionPercentiles &,
                             const ShapeData &, const ShapeData &,
                             const int, bool);
 
+static double bbox_dist(const Polyline &, const Polyline &);
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Code for class SingleFeature
@@ -138,6 +140,12 @@ void SingleFeature::clear()
    if(boundary) { delete [] boundary;  boundary = (Polyline *) 0; }
    n_bdy = 0;
 
+   mask_x_lo = mask_x_hi = 0;
+   mask_y_lo = mask_y_hi = 0;
+   mask_n_on = 0;
+   mask_row.clear();
+   mask_run.clear();
+
    return;
 }
 
@@ -185,6 +193,14 @@ void SingleFeature::assign(const SingleFeature & s)
    boundary = new Polyline [n_bdy];
    for(i=0; i<n_bdy; i++) boundary[i] = s.boundary[i];
 
+   mask_x_lo = s.mask_x_lo;
+   mask_x_hi = s.mask_x_hi;
+   mask_y_lo = s.mask_y_lo;
+   mask_y_hi = s.mask_y_hi;
+   mask_n_on = s.mask_n_on;
+   mask_row  = s.mask_row;
+   mask_run  = s.mask_run;
+
    return;
 }
 
@@ -272,6 +288,12 @@ void SingleFeature::set(const ShapeData &raw, const ShapeData &thresh,
       boundary[i] = obj_wd.single_boundary();
    }
 
+   //
+   // Mask runs for the pair intersection, union, and symmetric
+   // difference areas
+   //
+   set_mask_runs();
+
    //
    // Done
    //
@@ -279,6 +301,119 @@ void SingleFeature::set(const ShapeData &raw, const ShapeData &thresh,
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+
+void SingleFeature::set_mask_runs()
+
+{
+
+   int x, y, x_beg;
+   const int nx = Mask->data.nx();
+   const int ny = Mask->data.ny();
+
+   mask_row.clear();
+   mask_run.clear();
+   mask_n_on = 0;
+
+   //
+   // Bounding box of the points that are on
+   //
+   mask_x_lo = nx;
+   mask_x_hi = -1;
+   mask_y_lo = ny;
+   mask_y_hi = -1;
+
+   for(y=0; y<ny; y++) {
+      for(x=0; x<nx; x++) {
+         if(!Mask->s_is_on(x, y)) continue;
+         if(x < mask_x_lo) mask_x_lo = x;
+         if(x > mask_x_hi) mask_x_hi = x;
+         if(y < mask_y_lo) mask_y_lo = y;
+         if(y > mask_y_hi) mask_y_hi = y;
+      }
+   }
+
+   //
+   // Empty mask
+   //
+   if(mask_x_hi < 0) {
+      mask_x_lo = mask_x_hi = 0;
+      mask_y_lo = 0;
+      mask_y_hi = -1;
+      mask_row.push_back(0);
+      return;
+   }
+
+   //
+   // Runs of points that are on within each row of the box
+   //
+   for(y=mask_y_lo; y<=mask_y_hi; y++) {
+
+      mask_row.push_back((int) mask_run.size());
+
+      for(x=mask_x_lo; x<=mask_x_hi; x++) {
+
+         if(!Mask->s_is_on(x, y)) continue;
+
+         for(x_beg=x; x<mask_x_hi && Mask->s_is_on(x+1, y); x++);
+
+         mask_run.push_back(x_beg);
+         mask_run.push_back(x);
+         mask_n_on += x - x_beg + 1;
+      }
+   }
+
+   mask_row.push_back((int) mask_run.size());
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+int SingleFeature::mask_intersection(const SingleFeature &s) const
+
+{
+
+   int y, i, i_end, j, j_end, x_beg, x_end;
+   int n = 0;
+
+   //
+   // Only the rows and columns of the bounding box intersection
+   // can overlap
+   //
+   const int y_lo = max(mask_y_lo, s.mask_y_lo);
+   const int y_hi = min(mask_y_hi, s.mask_y_hi);
+
+   if(mask_n_on == 0 || s.mask_n_on == 0 ||
+      max(mask_x_lo, s.mask_x_lo) > min(mask_x_hi, s.mask_x_hi)) {
+      return(0);
+   }
+
+   for(y=y_lo; y<=y_hi; y++) {
+
+      i     =   mask_row[y -   mask_y_lo];
+      i_end =   mask_row[y -   mask_y_lo + 1];
+      j     = s.mask_row[y - s.mask_y_lo];
+      j_end = s.mask_row[y - s.mask_y_lo + 1];
+
+      //
+      // Step through the sorted runs of both rows
+      //
+      while(i < i_end && j < j_end) {
+
+         x_beg = max(  mask_run[i],   s.mask_run[j]);
+         x_end = min(  mask_run[i+1], s.mask_run[j+1]);
+
+         if(x_beg <= x_end) n += x_end - x_beg + 1;
+
+         if(mask_run[i+1] < s.mask_run[j+1]) i += 2;
+         else                                j += 2;
+      }
+   }
+
+   return(n);
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Code for class PairFeature
@@ -407,8 +542,6 @@ void PairFeature::set(const SingleFeature &fcst,
    Fcst = &fcst;
    Obs  = &obs;
 
-   int x, y;
-   int fcst_on, obs_on;
    double dx, dy;
    double a1, a2;
 
@@ -424,11 +557,15 @@ void PairFeature::set(const SingleFeature &fcst,
    //
    // Boundary distance:
    // Compute it as the minimum distance between any two pairs of
-   // polylines.
+   // polylines.  Skip pairs whose bounding boxes are already farther
+   // apart than the current minimum, since their distance can be no
+   // smaller.
    //
    boundary_dist = 1.0e30;
    for(i=0; i<Obs->n_bdy; i++) {
       for(j=0; j<Fcst->n_bdy; j++) {
+         if(bbox_dist(Obs->boundary[i], Fcst->boundary[j]) >
+            boundary_dist + loose_tol) continue;
          d = polyline_dist(Obs->boundary[i], Fcst->boundary[j]);
          if(d < boundary_dist) boundary_dist = d;
          if(is_eq(boundary_dist, 0.0)) break;
@@ -463,22 +600,14 @@ void PairFeature::set(const SingleFeature &fcst,
 
 
    //
-   // Intersection, union, and symmetric diff areas
+   // Intersection, union, and symmetric diff areas:
+   // Only the runs inside the intersection of the mask bounding
+   // boxes are compared.
    //
-   intersection_area = union_area = 0.0;
-   symmetric_diff = 0.0;
-   for(x=0; x<(Fcst->Mask->data.nx()); ++x) {
-      for(y=0; y<(Fcst->Mask->data.ny()); ++y) {
-
-         fcst_on = Fcst->Mask->s_is_on(x, y);
-         obs_on  =  Obs->Mask->s_is_on(x, y);
-
-         if(fcst_on && obs_on) intersection_area++;
-         if(fcst_on || obs_on) union_area++;
-         if((fcst_on && !obs_on) ||
-            (!fcst_on && obs_on)) symmetric_diff++;
-      }
-   }
+   intersection_area = (double) Fcst->mask_intersection(*Obs);
+   union_area        = (double) (Fcst->mask_n_on + Obs->mask_n_on)
+                       - intersection_area;
+   symmetric_diff    = union_area - intersection_area;
 
    //
    // Intersection over area
@@ -697,3 +826,30 @@ void get_percentiles(DistributionPercentiles &ptile,
 ////////////////////////////////////////////////////////////////////////
 
 
+
+//
+// Distance between the bounding boxes of two polylines, which is a
+// lower bound for polyline_dist().  Return zero if either is empty.
+//
+
+double bbox_dist(const Polyline &a, const Polyline &b)
+
+{
+
+   Box a_box, b_box;
+   double dx, dy;
+
+   if(a.n_points == 0 || b.n_points == 0) return(0.0);
+
+   a.bounding_box(a_box);
+   b.bounding_box(b_box);
+
+   dx = max(0.0, max(a_box.left() - b_box.right(),
+                     b_box.left() - a_box.right()));
+   dy = max(0.0, max(a_box.bottom() - b_box.top(),
+                     b_box.bottom() - a_box.top()));
+
+   return(sqrt(dx*dx + dy*dy));
+}
+
+////////////////////////////////////////////////////////////////////////
@@ -15,6 +15,7 @@
 ////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#include <vector>
 
 #include "shapedata.h"
 
@@ -81,6 +82,22 @@ class SingleFeature {
       Polyline  convex_hull;
       Polyline *boundary;   //  allocated
       int       n_bdy;
+
+      //
+      // Run-length encoding of the mask points that are on, by row
+      // of the mask bounding box.  Row y holds the [begin, end] column
+      // pairs of mask_run starting at mask_row[y - mask_y_lo].
+      //
+      int mask_x_lo, mask_x_hi;
+      int mask_y_lo, mask_y_hi;
+      int mask_n_on;
+
+      std::vector<int> mask_row;   //  one more than the number of rows
+      std::vector<int> mask_run;
+
+      void set_mask_runs();
+
+      int mask_intersection(const SingleFeature &) const;
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -518,18 +518,17 @@ void ShapeData::conv_filter_circ(int diameter, double vld_thresh)
 
 {
 
-int x, y, xx, yy, u, v;
-int dn, fn, nn;
-int vpr, upr;
+int x, y, xx, yy, v, w;
+int dn, nn;
+int x_lo, x_hi;
 int count, bd_count;
-double center, cur, sum;
+double center, sum;
 double dx, dy, dist;
 double vld_ratio;
+const double * row = (const double *) 0;
 const int nx = data.nx();
 const int ny = data.ny();
-bool * f = (bool *) 0;
 bool center_bad = false;
-DataPlane in_data = data;
 const bool vld_thresh_one = is_eq(vld_thresh, 1.0);
 
 
@@ -545,44 +544,76 @@ if ( (diameter%2 == 0) || (diameter < 3) )  {
 
 const int radius = (diameter - 1)/2;
 
-const vector<double> * in  = &(in_data.Data);
-      vector<double> * out = &(data.Data);
-
-f = new bool [diameter*diameter];
+const vector<double> & in  = data.Data;
+      vector<double>   out (in.size());
 
    //
    //  set up the filter
    //
+   //    the circular footprint covers a contiguous span of each
+   //    row, so only store its half width for each row offset
+   //
+
+vector<int> half_width (diameter, 0);
 
 for (y=0; y<diameter; ++y)  {
 
    dy = y - radius;
 
-   for (x=0; x<diameter; ++x)  {
+   for (x=radius; x<diameter; ++x)  {
 
       dx = x - radius;
 
       dist = sqrt( dx*dx + dy*dy );
 
-      fn = STANDARD_XY_YO_N(diameter, x, y) ;
+      if ( dist <= radius )  half_width[y] = x - radius;
+
+   }
+
+}
+
+   //
+   //  check each input value for bad data once, storing zero in its
+   //  place along with running counts of the valid values in each row
+   //
+   //    adding zero leaves the sum unchanged, so the values are still
+   //    summed in the same order as the tap-by-tap loop
+   //
+
+vector<double> zero_bad (in.size());
+vector<int>    n_good   ((nx + 1)*ny, 0);
+
+for (y=0; y<ny; ++y)  {
+
+   for (x=0; x<nx; ++x)  {
+
+      dn = STANDARD_XY_YO_N(nx, x, y);
 
-      f[fn] = (dist <= radius);
+      center_bad = ::is_bad_data(in[dn]);
+
+      zero_bad[dn] = ( center_bad ? 0.0 : in[dn] );
+
+      nn = y*(nx + 1) + x;
+
+      n_good[nn + 1] = n_good[nn] + ( center_bad ? 0 : 1 );
 
    }
 
 }
 
    //
-   //  do the convolution
+   //  do the convolution, one row of the output per thread
    //
 
-dn = -1;
+#pragma omp parallel for schedule(static) \
+        private(x, y, xx, yy, v, w, dn, nn, x_lo, x_hi, count, bd_count, \
+                center, sum, vld_ratio, row, center_bad)
 
 for(y=0; y<ny; y++) {
 
    for(x=0; x<nx; x++) {
 
-      ++dn;
+      dn = STANDARD_XY_YO_N(nx, x, y);
 
          //
          // If the bad data threshold is set to zero and the center of the
@@ -590,11 +621,11 @@ for(y=0; y<ny; y++) {
          // bad data and continue.
          //
 
-      center = (*in)[dn];
+      center = in[dn];
 
       center_bad = ::is_bad_data(center);
 
-      if ( center_bad && vld_thresh_one ) { (*out)[dn] = bad_data_double;  continue; }
+      if ( center_bad && vld_thresh_one ) { out[dn] = bad_data_double;  continue; }
 
       sum      = 0.0;
       count    = 0;
@@ -606,33 +637,25 @@ for(y=0; y<ny; y++) {
 
          if ( (yy < 0) || (yy >= ny) )  continue;
 
-         vpr = v + radius;
-
-         for(u=-radius; u<=radius; ++u) {
-
-            xx = x + u;
-
-            if ( (xx < 0) || (xx >= nx) )  continue;
-
-            upr = u + radius;
-
-            fn = STANDARD_XY_YO_N(diameter, upr, vpr);
+         w = half_width[v + radius];
 
-            if ( !(f[fn]) )  continue;
+         x_lo = max(x - w, 0);
+         x_hi = min(x + w, nx - 1);
 
-            nn = STANDARD_XY_YO_N(nx, xx, yy) ;
+         if ( x_lo > x_hi )  continue;
 
-            cur = (*in)[nn];
+         row = &zero_bad[STANDARD_XY_YO_N(nx, 0, yy)];
 
-            if( ::is_bad_data(cur) ) { bd_count++;  continue; }
+         for(xx=x_lo; xx<=x_hi; ++xx)  sum += row[xx];
 
-            sum += cur;
+         nn = yy*(nx + 1);
 
-            count++;
+         count    += n_good[nn + x_hi + 1] - n_good[nn + x_lo];
+         bd_count += x_hi - x_lo + 1;
 
-         } // for v
+      } // for v
 
-      } // for u
+      bd_count -= count;
 
          //
          //  If the center of the convolution contains bad data and the ratio
@@ -650,23 +673,22 @@ for(y=0; y<ny; y++) {
 
       }
 
-      (*out)[dn] = sum;
+      out[dn] = sum;
 
-   } // for y
+   } // for x
 
-} // for x
+} // for y
+
+data.Data = out;
 
    //
    //  done
    //
 
-if ( f )  { delete [] f;   f = (bool *) 0; }
-
 return;
 
 }
 
-
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -27,14 +27,33 @@ using namespace std;
 #include "vx_util.h"
 #include "vx_math.h"
 #include "vx_log.h"
+#include "two_d_array.h"
 
 ////////////////////////////////////////////////////////////////////////
 
-static void write_cntinfo(ofstream &, const CNTInfo &);
-static void write_ctsinfo(ofstream &, const CTSInfo &);
-static void write_mctsinfo(ofstream &, const MCTSInfo &);
-static void write_nbrcntinfo(ofstream &, const NBRCNTInfo &);
-static void read_ldf(const ConcatString, int, NumArray &);
+//
+// Number of statistics stored for each bootstrap replicate
+//
+static const int n_cnt_stats    = 25;
+static const int n_cts_stats    = 20;
+static const int n_mcts_stats   = 4;
+static const int n_nbrcnt_stats = 6;
+
+////////////////////////////////////////////////////////////////////////
+
+static void store_cntinfo(TwoD_Array<double> &, int, const CNTInfo &);
+static void store_ctsinfo(TwoD_Array<double> &, int, const CTSInfo &);
+static void store_mctsinfo(TwoD_Array<double> &, int, const MCTSInfo &);
+static void store_nbrcntinfo(TwoD_Array<double> &, int, const NBRCNTInfo &);
+static void read_column(const TwoD_Array<double> &, int, NumArray &);
+
+static void init_replicate_rngs(const gsl_rng *, int,
+                                vector<unsigned long> &,
+                                vector<gsl_rng *> &);
+static void free_replicate_rngs(vector<gsl_rng *> &);
+static void ran_sample_replicate(const vector<unsigned long> &,
+                                 const vector<gsl_rng *> &, int,
+                                 NumArray &, NumArray &, int);
 
 ////////////////////////////////////////////////////////////////////////
 //
@@ -286,12 +305,12 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
    CTSInfo *cts_tmp = (CTSInfo *) 0;
 
    //
-   // Temp file streams for categorical statistics
+   // Categorical statistics for each point removed and each replicate
    //
-   ofstream *cts_i_out = (ofstream *) 0, *cts_r_out = (ofstream *) 0;
-   ConcatString *cts_i_file = (ConcatString *) 0;
-   ConcatString *cts_r_file = (ConcatString *) 0;
-   ConcatString prefix;
+   TwoD_Array<double> *cts_i_buf = (TwoD_Array<double> *) 0;
+   TwoD_Array<double> *cts_r_buf = (TwoD_Array<double> *) 0;
+   vector<unsigned long> seeds;
+   vector<gsl_rng *> rngs;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -327,101 +346,61 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
 
    //
    // Allocate space to store categorical stats for each threshold
-   // and for the output temp file streams
+   // and for each point removed and each replicate
    //
-   cts_tmp    = new CTSInfo      [n_cts];
-   cts_i_out  = new ofstream     [n_cts];
-   cts_r_out  = new ofstream     [n_cts];
-   cts_i_file = new ConcatString [n_cts];
-   cts_r_file = new ConcatString [n_cts];
+   cts_tmp   = new CTSInfo            [n_cts];
+   cts_i_buf = new TwoD_Array<double> [n_cts];
+   cts_r_buf = new TwoD_Array<double> [n_cts];
    for(i=0; i<n_cts; i++) {
       cts_tmp[i].fthresh = cts_info[i].fthresh;
       cts_tmp[i].othresh = cts_info[i].othresh;
+      cts_i_buf[i].set_size(n_cts_stats, n);
+      cts_r_buf[i].set_size(n_cts_stats, b);
    }
 
    //
-   // Build the temp file names
+   // Draw the seed for each replicate up front so that the results
+   // do not depend on the number of threads
    //
-   for(i=0; i<n_cts; i++) {
-      prefix << cs_erase << tmp_dir << "/tmp_cts_i_" << i;
-      cts_i_file[i] = make_temp_file_name(prefix.c_str(), NULL);
-
-      prefix << cs_erase << tmp_dir << "/tmp_cts_r_" << i;
-      cts_r_file[i] = make_temp_file_name(prefix.c_str(), NULL);
-   }
+   init_replicate_rngs(rng_ptr, b, seeds, rngs);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Enclose computations in a try block to catch any errors
    //
    try {
 
-      //
-      // Open up the temp files
-      //
-      for(i=0; i<n_cts; i++) {
-         cts_i_out[i].open(cts_i_file[i].c_str());
-         cts_r_out[i].open(cts_r_file[i].c_str());
-         if(!cts_i_out[i] || !cts_r_out[i]) {
-            mlog << Error << "\ncompute_cts_stats_ci_bca() -> "
-                 << "can't open one or more temporary files for writing:\n"
-                 << cts_i_file[i] << "\n"
-                 << cts_r_file[i] << "\n\n";
-
-            //
-            // Attempt to delete temp files
-            //
-            for(i=0; i<n_cts; i++) {
-               remove_temp_file(cts_i_file[i]);
-               remove_temp_file(cts_r_file[i]);
-            }
-
-            // deallocate memory
-            if(cts_tmp)    { delete [] cts_tmp;    cts_tmp    = (CTSInfo *)      0; }
-            if(cts_i_out)  { delete [] cts_i_out;  cts_i_out  = (ofstream *)     0; }
-            if(cts_r_out)  { delete [] cts_r_out;  cts_r_out  = (ofstream *)     0; }
-            if(cts_i_file) { delete [] cts_i_file; cts_i_file = (ConcatString *) 0; }
-            if(cts_r_file) { delete [] cts_r_file; cts_r_file = (ConcatString *) 0; }
-            throw(1);
-         }
-      }
-
       //
       // Compute catgegorical stats from the raw data with the i-th data
-      // point removed and write out to a temp file
+      // point removed
       //
       for(i=0; i<n_cts; i++) {
+#pragma omp parallel for schedule(dynamic)
          for(j=0; j<n; j++) {
-            compute_i_ctsinfo(pd, j, false, cts_tmp[i]);
-            write_ctsinfo(cts_i_out[i], cts_tmp[i]);
+            CTSInfo cts_j = cts_tmp[i];
+            compute_i_ctsinfo(pd, j, false, cts_j);
+            store_ctsinfo(cts_i_buf[i], j, cts_j);
          }
       } // end for i
 
       //
       // Resample the array of indices with replacement
       //
+#pragma omp parallel for schedule(dynamic) private(j) firstprivate(ir_na)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+         ran_sample_replicate(seeds, rngs, i, i_na, ir_na, n);
 
          //
          // Compute categorical stats for each replicate with the
          // cts_flag set and the normal_ci_flag unset
          //
          for(j=0; j<n_cts; j++) {
-            compute_ctsinfo(pd, ir_na, true, false, cts_tmp[j]);
-            write_ctsinfo(cts_r_out[j], cts_tmp[j]);
+            CTSInfo cts_j = cts_tmp[j];
+            compute_ctsinfo(pd, ir_na, true, false, cts_j);
+            store_ctsinfo(cts_r_buf[j], i, cts_j);
          } // end for j
       }
 
-      //
-      // Close the temp files
-      //
-      for(i=0; i<n_cts; i++) {
-         cts_i_out[i].close();
-         cts_r_out[i].close();
-      }
-
       //
       // Compute bootstrap intervals for each threshold value
       //
@@ -430,14 +409,14 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          //
          // Initialize column counter
          //
-         c = 1;
+         c = 0;
 
          //
          // Compute bootstrap interval for baser
          //
          s = cts_info[i].baser.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -448,8 +427,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for fmean
          //
          s = cts_info[i].fmean.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -460,8 +439,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for acc
          //
          s = cts_info[i].acc.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -472,8 +451,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for fbias
          //
          s = cts_info[i].fbias.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -484,8 +463,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for pody
          //
          s = cts_info[i].pody.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -496,8 +475,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for podn
          //
          s = cts_info[i].podn.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -508,8 +487,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for pofd
          //
          s = cts_info[i].pofd.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -520,8 +499,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for far
          //
          s = cts_info[i].far.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -532,8 +511,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for csi
          //
          s = cts_info[i].csi.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -544,8 +523,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for gss
          //
          s = cts_info[i].gss.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -556,8 +535,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for hk
          //
          s = cts_info[i].hk.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -568,8 +547,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for hss
          //
          s = cts_info[i].hss.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -580,8 +559,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for odds
          //
          s = cts_info[i].odds.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -592,8 +571,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for lodds
          //
          s = cts_info[i].lodds.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -604,8 +583,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for orss
          //
          s = cts_info[i].orss.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -616,8 +595,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for eds
          //
          s = cts_info[i].eds.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -628,8 +607,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for seds
          //
          s = cts_info[i].seds.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -640,8 +619,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for edi
          //
          s = cts_info[i].edi.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -652,8 +631,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for sedi
          //
          s = cts_info[i].sedi.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -664,8 +643,8 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for bagss
          //
          s = cts_info[i].bagss.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_i_buf[i], c,   si_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  cts_info[i].alpha[j],
@@ -682,28 +661,19 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
 
       mlog << Error << "\ncompute_cts_stats_ci_bca() -> "
            << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+           << ".\n\n";
 
 
       exit(i_err);
    } // end catch block
 
-   //
-   // Delete temp files
-   //
-   for(i=0; i<n_cts; i++) {
-      remove_temp_file(cts_i_file[i]);
-      remove_temp_file(cts_r_file[i]);
-   }
-
    //
    // Deallocate memory
    //
-   if(cts_tmp)    { delete [] cts_tmp;    cts_tmp    = (CTSInfo *)      0; }
-   if(cts_i_out)  { delete [] cts_i_out;  cts_i_out  = (ofstream *)     0; }
-   if(cts_r_out)  { delete [] cts_r_out;  cts_r_out  = (ofstream *)     0; }
-   if(cts_i_file) { delete [] cts_i_file; cts_i_file = (ConcatString *) 0; }
-   if(cts_r_file) { delete [] cts_r_file; cts_r_file = (ConcatString *) 0; }
+   free_replicate_rngs(rngs);
+   if(cts_tmp)   { delete [] cts_tmp;   cts_tmp   = (CTSInfo *)            0; }
+   if(cts_i_buf) { delete [] cts_i_buf; cts_i_buf = (TwoD_Array<double> *) 0; }
+   if(cts_r_buf) { delete [] cts_r_buf; cts_r_buf = (TwoD_Array<double> *) 0; }
 
    return;
 }
@@ -733,10 +703,11 @@ void compute_mcts_stats_ci_bca(const gsl_rng *rng_ptr,
    MCTSInfo mcts_tmp;
 
    //
-   // Temp file streams for categorical statistics
+   // Statistics for each point removed and each replicate
    //
-   ofstream mcts_i_out, mcts_r_out;
-   ConcatString mcts_i_file, mcts_r_file, prefix;
+   TwoD_Array<double> mcts_i_buf, mcts_r_buf;
+   vector<unsigned long> seeds;
+   vector<gsl_rng *> rngs;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -774,74 +745,60 @@ void compute_mcts_stats_ci_bca(const gsl_rng *rng_ptr,
    mcts_tmp = mcts_info;
 
    //
-   // Build the temp file names
+   // Allocate space to store the statistics for each point removed
+   // and each replicate
    //
-   prefix << cs_erase << tmp_dir << "/tmp_mcts_i";
-   mcts_i_file = make_temp_file_name(prefix.c_str(), NULL);
+   mcts_i_buf.set_size(n_mcts_stats, n);
+   mcts_r_buf.set_size(n_mcts_stats, b);
 
-   prefix << cs_erase << tmp_dir << "/tmp_mcts_r";
-   mcts_r_file = make_temp_file_name(prefix.c_str(), NULL);
+   //
+   // Draw the seed for each replicate up front so that the results
+   // do not depend on the number of threads
+   //
+   init_replicate_rngs(rng_ptr, b, seeds, rngs);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Enclose computations in a try block to catch any errors
    //
    try {
 
-      //
-      // Open up the temp files
-      //
-      mcts_i_out.open(mcts_i_file.c_str());
-      mcts_r_out.open(mcts_r_file.c_str());
-      if(!mcts_i_out || !mcts_r_out) {
-         mlog << Error << "\ncompute_mcts_stats_ci_bca() -> "
-              << "can't open one or more temporary files for writing:\n"
-              << mcts_i_file << "\n"
-              << mcts_r_file << "\n\n";
-         throw(1);
-      }
-
       //
       // Compute catgegorical stats from the raw data with the i-th data
-      // point removed and write out to a temp file
+      // point removed
       //
+#pragma omp parallel for schedule(dynamic) firstprivate(mcts_tmp)
       for(i=0; i<n; i++) {
          compute_i_mctsinfo(pd, i, false, mcts_tmp);
-         write_mctsinfo(mcts_i_out, mcts_tmp);
-      } // end for i
+         store_mctsinfo(mcts_i_buf, i, mcts_tmp);
+      }
 
       //
       // Resample the array of indices with replacement
       //
+#pragma omp parallel for schedule(dynamic) firstprivate(ir_na, mcts_tmp)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+         ran_sample_replicate(seeds, rngs, i, i_na, ir_na, n);
 
          //
          // Compute categorical stats for each replicate with the
          // cts_flag set and the normal_ci_flag unset
          //
          compute_mctsinfo(pd, ir_na, true, false, mcts_tmp);
-         write_mctsinfo(mcts_r_out, mcts_tmp);
+         store_mctsinfo(mcts_r_buf, i, mcts_tmp);
       }
 
-      //
-      // Close the temp files
-      //
-      mcts_i_out.close();
-      mcts_r_out.close();
-
       //
       // Initialize column counter
       //
-      c = 1;
+      c = 0;
 
       //
       // Compute bootstrap interval for acc
       //
       s = mcts_info.acc.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
+      read_column(mcts_i_buf, c,   si_na);
+      read_column(mcts_r_buf, c++, sr_na);
       for(i=0; i<mcts_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               mcts_info.alpha[i],
@@ -852,8 +809,8 @@ void compute_mcts_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for hk
       //
       s = mcts_info.hk.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
+      read_column(mcts_i_buf, c,   si_na);
+      read_column(mcts_r_buf, c++, sr_na);
       for(i=0; i<mcts_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               mcts_info.alpha[i],
@@ -864,8 +821,8 @@ void compute_mcts_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for hss
       //
       s = mcts_info.hss.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
+      read_column(mcts_i_buf, c,   si_na);
+      read_column(mcts_r_buf, c++, sr_na);
       for(i=0; i<mcts_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               mcts_info.alpha[i],
@@ -876,8 +833,8 @@ void compute_mcts_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for ger
       //
       s = mcts_info.ger.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
+      read_column(mcts_i_buf, c,   si_na);
+      read_column(mcts_r_buf, c++, sr_na);
       for(i=0; i<mcts_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               mcts_info.alpha[i],
@@ -893,22 +850,15 @@ void compute_mcts_stats_ci_bca(const gsl_rng *rng_ptr,
 
       mlog << Error << "\ncompute_mcts_stats_ci_bca() -> "
            << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
-
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(mcts_i_file);
-      remove_temp_file(mcts_r_file);
+           << ".\n\n";
 
       exit(i_err);
    } // end catch block
 
    //
-   // Delete temp files
+   // Deallocate memory
    //
-   remove_temp_file(mcts_i_file);
-   remove_temp_file(mcts_r_file);
+   free_replicate_rngs(rngs);
 
    return;
 }
@@ -939,10 +889,11 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
    CNTInfo cnt_tmp;
 
    //
-   // Temp file streams for continuous statistics
+   // Statistics for each point removed and each replicate
    //
-   ofstream cnt_i_out, cnt_r_out;
-   ConcatString cnt_i_file, cnt_r_file, prefix;
+   TwoD_Array<double> cnt_i_buf, cnt_r_buf;
+   vector<unsigned long> seeds;
+   vector<gsl_rng *> rngs;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -974,74 +925,60 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
    if(n<=1 || b<1) return;
 
    //
-   // Build the temp file names
+   // Allocate space to store the statistics for each point removed
+   // and each replicate
    //
-   prefix << cs_erase << tmp_dir << "/tmp_cnt_i";
-   cnt_i_file = make_temp_file_name(prefix.c_str(), NULL);
+   cnt_i_buf.set_size(n_cnt_stats, n);
+   cnt_r_buf.set_size(n_cnt_stats, b);
 
-   prefix << cs_erase << tmp_dir << "/tmp_cnt_r";
-   cnt_r_file = make_temp_file_name(prefix.c_str(), NULL);
+   //
+   // Draw the seed for each replicate up front so that the results
+   // do not depend on the number of threads
+   //
+   init_replicate_rngs(rng_ptr, b, seeds, rngs);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Enclose computations in a try block to catch any errors
    //
    try {
 
-      //
-      // Open up the temp files
-      //
-      cnt_i_out.open(cnt_i_file.c_str());
-      cnt_r_out.open(cnt_r_file.c_str());
-      if(!cnt_i_out || !cnt_r_out) {
-         mlog << Error << "\ncompute_cnt_stats_ci_bca() -> "
-              << "can't open one or more temporary files for writing:\n"
-              << cnt_i_file << "\n"
-              << cnt_r_file << "\n\n";
-         throw(1);
-      }
-
       //
       // Compute continuous stats from the raw data with the i-th data
-      // point removed and write out to a temp file
+      // point removed
       //
+#pragma omp parallel for schedule(dynamic) firstprivate(cnt_tmp)
       for(i=0; i<n; i++) {
          compute_i_cntinfo(pd, i, precip_flag, false, false, cnt_tmp);
-         write_cntinfo(cnt_i_out, cnt_tmp);
+         store_cntinfo(cnt_i_buf, i, cnt_tmp);
       }
 
       //
       // Resample the array of indices with replacement
       //
+#pragma omp parallel for schedule(dynamic) firstprivate(ir_na, cnt_tmp)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+         ran_sample_replicate(seeds, rngs, i, i_na, ir_na, n);
 
          //
          // Compute continuous stats for each replicate with the
          // rank_flag and normal_ci_flag unset
          //
          compute_cntinfo(pd, ir_na, precip_flag, false, false, cnt_tmp);
-         write_cntinfo(cnt_r_out, cnt_tmp);
+         store_cntinfo(cnt_r_buf, i, cnt_tmp);
       }
 
-      //
-      // Close the temp files
-      //
-      cnt_i_out.close();
-      cnt_r_out.close();
-
       //
       // Initialize column counter
       //
-      c = 1;
+      c = 0;
 
       //
       // Compute bootstrap interval for fbar
       //
       s = cnt_info.fbar.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1052,8 +989,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for fstdev
       //
       s = cnt_info.fstdev.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1064,8 +1001,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for obar
       //
       s = cnt_info.obar.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1076,8 +1013,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for ostdev
       //
       s = cnt_info.ostdev.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1089,8 +1026,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for pr_corr
       //
       s = cnt_info.pr_corr.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1101,8 +1038,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for anom_corr
       //
       s = cnt_info.anom_corr.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1113,8 +1050,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for rmsfa
       //
       s = cnt_info.rmsfa.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1125,8 +1062,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for rmsoa
       //
       s = cnt_info.rmsoa.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1137,8 +1074,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for anom_corr_uncntr
       //
       s = cnt_info.anom_corr_uncntr.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1149,8 +1086,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for me
       //
       s = cnt_info.me.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1161,8 +1098,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for me2
       //
       s = cnt_info.me2.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1173,8 +1110,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for estdev
       //
       s = cnt_info.estdev.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1185,8 +1122,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for mbias
       //
       s = cnt_info.mbias.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1197,8 +1134,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for mae
       //
       s = cnt_info.mae.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1209,8 +1146,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for mse
       //
       s = cnt_info.mse.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1221,8 +1158,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for msess
       //
       s = cnt_info.msess.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1233,8 +1170,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for bcmse
       //
       s = cnt_info.bcmse.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1245,8 +1182,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for rmse
       //
       s = cnt_info.rmse.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1257,8 +1194,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for e10
       //
       s = cnt_info.e10.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1269,8 +1206,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for e25
       //
       s = cnt_info.e25.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1281,8 +1218,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for e50
       //
       s = cnt_info.e50.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1293,8 +1230,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for e75
       //
       s = cnt_info.e75.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1305,8 +1242,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for e90
       //
       s = cnt_info.e90.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1317,8 +1254,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for eiqr
       //
       s = cnt_info.eiqr.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1329,8 +1266,8 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for mad
       //
       s = cnt_info.mad.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_i_buf, c,   si_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               cnt_info.alpha[i],
@@ -1345,22 +1282,15 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
 
       mlog << Error << "\ncompute_cnt_stats_ci_bca() -> "
            << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
-
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(cnt_i_file);
-      remove_temp_file(cnt_r_file);
+           << ".\n\n";
 
       exit(i_err);
    } // end catch block
 
    //
-   // Delete temp files
+   // Deallocate memory
    //
-   remove_temp_file(cnt_i_file);
-   remove_temp_file(cnt_r_file);
+   free_replicate_rngs(rngs);
 
    return;
 }
@@ -1386,10 +1316,11 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
    CTSInfo *cts_tmp = (CTSInfo *) 0;
 
    //
-   // Temp file streams for categorical statistics
+   // Categorical statistics for each replicate
    //
-   ofstream *cts_r_out = (ofstream *) 0;
-   ConcatString *cts_r_file = (ConcatString *) 0, prefix;
+   TwoD_Array<double> *cts_r_buf = (TwoD_Array<double> *) 0;
+   vector<unsigned long> seeds;
+   vector<gsl_rng *> rngs;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -1430,74 +1361,46 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
 
    //
    // Allocate space to store categorical stats for each threshold
-   // and for the output temp file streams
+   // and for each replicate
    //
-   cts_tmp    = new CTSInfo [n_cts];
-   cts_r_out  = new ofstream [n_cts];
-   cts_r_file = new ConcatString [n_cts];
+   cts_tmp   = new CTSInfo            [n_cts];
+   cts_r_buf = new TwoD_Array<double> [n_cts];
    for(i=0; i<n_cts; i++) {
       cts_tmp[i].fthresh = cts_info[i].fthresh;
       cts_tmp[i].othresh = cts_info[i].othresh;
+      cts_r_buf[i].set_size(n_cts_stats, b);
    }
 
    //
-   // Build the temp file names
+   // Draw the seed for each replicate up front so that the results
+   // do not depend on the number of threads
    //
-   for(i=0; i<n_cts; i++) {
-      prefix << cs_erase << tmp_dir << "/tmp_cts_r_" << i;
-      cts_r_file[i] = make_temp_file_name(prefix.c_str(), NULL);
-   }
+   init_replicate_rngs(rng_ptr, b, seeds, rngs);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Enclose computations in a try block to catch any errors
    //
    try {
 
-      //
-      // Open up the temp files
-      //
-      for(i=0; i<n_cts; i++) {
-         cts_r_out[i].open(cts_r_file[i].c_str());
-         if(!cts_r_out[i]) {
-            mlog << Error << "\ncompute_cts_stats_ci_perc() -> "
-                 << "can't open the temporary file for writing:\n"
-                 << cts_r_file[i] << "\n\n";
-           //
-           // Attempt to delete temp files
-           //
-           for(i=0; i<n_cts; i++) remove_temp_file(cts_r_file[i]);
-
-           if(cts_tmp)    { delete [] cts_tmp;    cts_tmp    = (CTSInfo *)      0; }
-           if(cts_r_out)  { delete [] cts_r_out;  cts_r_out  = (ofstream *)     0; }
-           if(cts_r_file) { delete [] cts_r_file; cts_r_file = (ConcatString *) 0; }
-
-            throw(1);
-         }
-      }
-
       //
       // Resample the array of indices with replacement
       //
+#pragma omp parallel for schedule(dynamic) private(j) firstprivate(ir_na)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, m);
+         ran_sample_replicate(seeds, rngs, i, i_na, ir_na, m);
 
          //
          // Compute categorical stats for each replicate with the
          // cts_flag set and the normal_ci_flag unset
          //
          for(j=0; j<n_cts; j++) {
-            compute_ctsinfo(pd, ir_na, true, false, cts_tmp[j]);
-            write_ctsinfo(cts_r_out[j], cts_tmp[j]);
+            CTSInfo cts_j = cts_tmp[j];
+            compute_ctsinfo(pd, ir_na, true, false, cts_j);
+            store_ctsinfo(cts_r_buf[j], i, cts_j);
          } // end for j
       }
 
-      //
-      // Close the temp files
-      //
-      for(i=0; i<n_cts; i++) cts_r_out[i].close();
-
       //
       // Compute bootstrap intervals for each threshold value
       //
@@ -1506,13 +1409,13 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          //
          // Initialize column counter
          //
-         c = 1;
+         c = 0;
 
          //
          // Compute bootstrap interval for baser
          //
          s = cts_info[i].baser.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1523,7 +1426,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for fmean
          //
          s = cts_info[i].fmean.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1534,7 +1437,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for acc
          //
          s = cts_info[i].acc.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1545,7 +1448,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for fbias
          //
          s = cts_info[i].fbias.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1556,7 +1459,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for pody
          //
          s = cts_info[i].pody.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1567,7 +1470,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for podn
          //
          s = cts_info[i].podn.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1578,7 +1481,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for pofd
          //
          s = cts_info[i].pofd.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1589,7 +1492,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for far
          //
          s = cts_info[i].far.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1600,7 +1503,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for csi
          //
          s = cts_info[i].csi.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1611,7 +1514,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for gss
          //
          s = cts_info[i].gss.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1622,7 +1525,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for hk
          //
          s = cts_info[i].hk.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1633,7 +1536,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for hss
          //
          s = cts_info[i].hss.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1644,7 +1547,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for odds
          //
          s = cts_info[i].odds.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1655,7 +1558,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for lodds
          //
          s = cts_info[i].lodds.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1666,7 +1569,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for orss
          //
          s = cts_info[i].orss.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1677,7 +1580,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for eds
          //
          s = cts_info[i].eds.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1688,7 +1591,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for seds
          //
          s = cts_info[i].seds.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1699,7 +1602,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for edi
          //
          s = cts_info[i].edi.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1710,7 +1613,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for sedi
          //
          s = cts_info[i].sedi.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1721,7 +1624,7 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for bagss
          //
          s = cts_info[i].bagss.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
+         read_column(cts_r_buf[i], c++, sr_na);
          for(j=0; j<cts_info[i].n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  cts_info[i].alpha[j],
@@ -1738,24 +1641,17 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
 
       mlog << Error << "\ncompute_cts_stats_ci_perc() -> "
            << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+           << ".\n\n";
 
       exit(i_err);
    } // end catch block
 
-   //
-   // Delete temp files
-   //
-   for(i=0; i<n_cts; i++) {
-      remove_temp_file(cts_r_file[i]);
-   }
-
    //
    // Deallocate memory
    //
-   if(cts_tmp)    { delete [] cts_tmp;    cts_tmp    = (CTSInfo *)      0; }
-   if(cts_r_out)  { delete [] cts_r_out;  cts_r_out  = (ofstream *)     0; }
-   if(cts_r_file) { delete [] cts_r_file; cts_r_file = (ConcatString *) 0; }
+   free_replicate_rngs(rngs);
+   if(cts_tmp)   { delete [] cts_tmp;   cts_tmp   = (CTSInfo *)            0; }
+   if(cts_r_buf) { delete [] cts_r_buf; cts_r_buf = (TwoD_Array<double> *) 0; }
 
    return;
 }
@@ -1781,10 +1677,11 @@ void compute_mcts_stats_ci_perc(const gsl_rng *rng_ptr,
    MCTSInfo mcts_tmp;
 
    //
-   // Temp file streams for categorical statistics
+   // Statistics for each replicate
    //
-   ofstream mcts_r_out;
-   ConcatString mcts_r_file, prefix;
+   TwoD_Array<double> mcts_r_buf;
+   vector<unsigned long> seeds;
+   vector<gsl_rng *> rngs;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -1827,58 +1724,47 @@ void compute_mcts_stats_ci_perc(const gsl_rng *rng_ptr,
    mcts_tmp = mcts_info;
 
    //
-   // Build the temp file names
+   // Allocate space to store the statistics for each replicate
    //
-   prefix << cs_erase << tmp_dir << "/tmp_mcts_r";
-   mcts_r_file = make_temp_file_name(prefix.c_str(), NULL);
+   mcts_r_buf.set_size(n_mcts_stats, b);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Draw the seed for each replicate up front so that the results
+   // do not depend on the number of threads
    //
-   try {
+   init_replicate_rngs(rng_ptr, b, seeds, rngs);
 
-      //
-      // Open up the temp file
-      //
-      mcts_r_out.open(mcts_r_file.c_str());
-      if(!mcts_r_out) {
-         mlog << Error << "\ncompute_mcts_stats_ci_perc() -> "
-              << "can't open the temporary file for writing:\n"
-              << mcts_r_file << "\n\n";
-         throw(1);
-      }
+   //
+   // Enclose computations in a try block to catch any errors
+   //
+   try {
 
       //
       // Resample the array of indices with replacement
       //
+#pragma omp parallel for schedule(dynamic) firstprivate(ir_na, mcts_tmp)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, m);
+         ran_sample_replicate(seeds, rngs, i, i_na, ir_na, m);
 
          //
          // Compute multi-category stats for each replicate with the
          // mcts_flag set and the normal_ci_flag unset
          //
          compute_mctsinfo(pd, ir_na, true, false, mcts_tmp);
-         write_mctsinfo(mcts_r_out, mcts_tmp);
+         store_mctsinfo(mcts_r_buf, i, mcts_tmp);
       }
 
-      //
-      // Close the temp file
-      //
-      mcts_r_out.close();
-
       //
       // Initialize column counter
       //
-      c = 1;
+      c = 0;
 
       //
       // Compute bootstrap interval for acc
       //
       s = mcts_info.acc.v;
-      read_ldf(mcts_r_file, c++, sr_na);
+      read_column(mcts_r_buf, c++, sr_na);
       for(i=0; i<mcts_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                mcts_info.alpha[i],
@@ -1889,7 +1775,7 @@ void compute_mcts_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for hk
       //
       s = mcts_info.hk.v;
-      read_ldf(mcts_r_file, c++, sr_na);
+      read_column(mcts_r_buf, c++, sr_na);
       for(i=0; i<mcts_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                mcts_info.alpha[i],
@@ -1900,7 +1786,7 @@ void compute_mcts_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for hss
       //
       s = mcts_info.hss.v;
-      read_ldf(mcts_r_file, c++, sr_na);
+      read_column(mcts_r_buf, c++, sr_na);
       for(i=0; i<mcts_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                mcts_info.alpha[i],
@@ -1911,7 +1797,7 @@ void compute_mcts_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for ger
       //
       s = mcts_info.ger.v;
-      read_ldf(mcts_r_file, c++, sr_na);
+      read_column(mcts_r_buf, c++, sr_na);
       for(i=0; i<mcts_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                mcts_info.alpha[i],
@@ -1926,20 +1812,15 @@ void compute_mcts_stats_ci_perc(const gsl_rng *rng_ptr,
 
       mlog << Error << "\ncompute_mcts_stats_ci_perc() -> "
            << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
-
-      //
-      // Attempt to delete temp file
-      //
-      remove_temp_file(mcts_r_file);
+           << ".\n\n";
 
       exit(i_err);
    } // end catch block
 
    //
-   // Delete temp file
+   // Deallocate memory
    //
-   remove_temp_file(mcts_r_file);
+   free_replicate_rngs(rngs);
 
    return;
 }
@@ -1964,10 +1845,11 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
    CNTInfo cnt_tmp;
 
    //
-   // Temp file streams for continuous statistics
+   // Statistics for each replicate
    //
-   ofstream cnt_r_out;
-   ConcatString cnt_r_file, prefix;
+   TwoD_Array<double> cnt_r_buf;
+   vector<unsigned long> seeds;
+   vector<gsl_rng *> rngs;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -2004,58 +1886,47 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
    if(n<=1 || b<1) return;
 
    //
-   // Build the temp file names
+   // Allocate space to store the statistics for each replicate
    //
-   prefix << cs_erase << tmp_dir << "/tmp_cnt_r";
-   cnt_r_file = make_temp_file_name(prefix.c_str(), NULL);
+   cnt_r_buf.set_size(n_cnt_stats, b);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Draw the seed for each replicate up front so that the results
+   // do not depend on the number of threads
    //
-   try {
+   init_replicate_rngs(rng_ptr, b, seeds, rngs);
 
-      //
-      // Open up the temp files
-      //
-      cnt_r_out.open(cnt_r_file.c_str());
-      if(!cnt_r_out) {
-         mlog << Error << "\ncompute_cnt_stats_ci_perc() -> "
-              << "can't open the temporary file for writing:\n"
-              << cnt_r_file << "\n\n";
-         throw(1);
-      }
+   //
+   // Enclose computations in a try block to catch any errors
+   //
+   try {
 
       //
       // Resample the array of indices with replacement
       //
+#pragma omp parallel for schedule(dynamic) firstprivate(ir_na, cnt_tmp)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, m);
+         ran_sample_replicate(seeds, rngs, i, i_na, ir_na, m);
 
          //
          // Compute continuous stats for each replicate with the
          // rank_flag and normal_ci_flag unset
          //
          compute_cntinfo(pd, ir_na, precip_flag, false, false, cnt_tmp);
-         write_cntinfo(cnt_r_out, cnt_tmp);
+         store_cntinfo(cnt_r_buf, i, cnt_tmp);
       }
 
-      //
-      // Close the temp files
-      //
-      cnt_r_out.close();
-
       //
       // Initialize column counter
       //
-      c = 1;
+      c = 0;
 
       //
       // Compute bootstrap interval for fbar
       //
       s = cnt_info.fbar.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2066,7 +1937,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for fstdev
       //
       s = cnt_info.fstdev.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2077,7 +1948,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for obar
       //
       s = cnt_info.obar.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2088,7 +1959,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for ostdev
       //
       s = cnt_info.ostdev.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2100,7 +1971,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for pr_corr
       //
       s = cnt_info.pr_corr.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2111,7 +1982,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for anom_corr
       //
       s = cnt_info.anom_corr.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2122,7 +1993,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for rmsfa
       //
       s = cnt_info.rmsfa.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2133,7 +2004,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for rmsoa
       //
       s = cnt_info.rmsoa.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2144,7 +2015,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for anom_corr_uncntr
       //
       s = cnt_info.anom_corr_uncntr.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2155,7 +2026,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for me
       //
       s = cnt_info.me.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2166,7 +2037,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for me2
       //
       s = cnt_info.me2.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2177,7 +2048,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for estdev
       //
       s = cnt_info.estdev.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2188,7 +2059,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for mbias
       //
       s = cnt_info.mbias.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2199,7 +2070,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for mae
       //
       s = cnt_info.mae.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2210,7 +2081,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for mse
       //
       s = cnt_info.mse.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2221,7 +2092,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for msess
       //
       s = cnt_info.msess.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2232,7 +2103,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for bcmse
       //
       s = cnt_info.bcmse.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2243,7 +2114,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for rmse
       //
       s = cnt_info.rmse.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2254,7 +2125,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for e10
       //
       s = cnt_info.e10.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2265,7 +2136,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for e25
       //
       s = cnt_info.e25.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2276,7 +2147,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for e50
       //
       s = cnt_info.e50.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2287,7 +2158,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for e75
       //
       s = cnt_info.e75.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2298,7 +2169,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for e90
       //
       s = cnt_info.e90.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2309,7 +2180,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for eiqr
       //
       s = cnt_info.eiqr.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2320,7 +2191,7 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for mad
       //
       s = cnt_info.mad.v;
-      read_ldf(cnt_r_file, c++, sr_na);
+      read_column(cnt_r_buf, c++, sr_na);
       for(i=0; i<cnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                                cnt_info.alpha[i],
@@ -2335,20 +2206,15 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
 
       mlog << Error << "\ncompute_cnt_stats_ci_perc() -> "
            << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
-
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(cnt_r_file);
+           << ".\n\n";
 
       exit(i_err);
    } // end catch block
 
    //
-   // Delete temp files
+   // Deallocate memory
    //
-   remove_temp_file(cnt_r_file);
+   free_replicate_rngs(rngs);
 
    return;
 }
@@ -2367,10 +2233,12 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
    NBRCTSInfo *nbrcts_tmp = (NBRCTSInfo *) 0;
 
    //
-   // Temp file streams for categorical statistics
+   // Categorical statistics for each point removed and each replicate
    //
-   ofstream *nbrcts_i_out = (ofstream *) 0, *nbrcts_r_out = (ofstream *) 0;
-   ConcatString *nbrcts_i_file = (ConcatString *) 0, *nbrcts_r_file = (ConcatString *) 0, prefix;
+   TwoD_Array<double> *nbrcts_i_buf = (TwoD_Array<double> *) 0;
+   TwoD_Array<double> *nbrcts_r_buf = (TwoD_Array<double> *) 0;
+   vector<unsigned long> seeds;
+   vector<gsl_rng *> rngs;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -2407,106 +2275,64 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
 
    //
    // Allocate space to store categorical stats for each threshold
-   // and for the output temp file streams
+   // and for each point removed and each replicate
    //
-   nbrcts_tmp    = new NBRCTSInfo [n_nbrcts];
-   nbrcts_i_out  = new ofstream [n_nbrcts];
-   nbrcts_r_out  = new ofstream [n_nbrcts];
-   nbrcts_i_file = new ConcatString [n_nbrcts];
-   nbrcts_r_file = new ConcatString [n_nbrcts];
+   nbrcts_tmp   = new NBRCTSInfo         [n_nbrcts];
+   nbrcts_i_buf = new TwoD_Array<double> [n_nbrcts];
+   nbrcts_r_buf = new TwoD_Array<double> [n_nbrcts];
    for(i=0; i<n_nbrcts; i++) {
       nbrcts_tmp[i].cts_info.fthresh = nbrcts_info[i].cts_info.fthresh;
       nbrcts_tmp[i].cts_info.othresh = nbrcts_info[i].cts_info.othresh;
       nbrcts_tmp[i].fthresh          = nbrcts_info[i].fthresh;
       nbrcts_tmp[i].othresh          = nbrcts_info[i].othresh;
       nbrcts_tmp[i].cthresh          = nbrcts_info[i].cthresh;
+      nbrcts_i_buf[i].set_size(n_cts_stats, n);
+      nbrcts_r_buf[i].set_size(n_cts_stats, b);
    }
 
    //
-   // Build the temp file names
+   // Draw the seed for each replicate up front so that the results
+   // do not depend on the number of threads
    //
-   for(i=0; i<n_nbrcts; i++) {
-      prefix << cs_erase << tmp_dir << "/tmp_nbrcts_i_" << i;
-      nbrcts_i_file[i] = make_temp_file_name(prefix.c_str(), NULL);
-
-      prefix << cs_erase << tmp_dir << "/tmp_nbrcts_r_" << i;
-      nbrcts_r_file[i] = make_temp_file_name(prefix.c_str(), NULL);
-   }
+   init_replicate_rngs(rng_ptr, b, seeds, rngs);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Enclose computations in a try block to catch any errors
    //
    try {
 
-      //
-      // Open up the temp files
-      //
-      for(i=0; i<n_nbrcts; i++) {
-         nbrcts_i_out[i].open(nbrcts_i_file[i].c_str());
-         nbrcts_r_out[i].open(nbrcts_r_file[i].c_str());
-         if(!nbrcts_i_out[i] || !nbrcts_r_out[i]) {
-            mlog << Error << "\ncompute_nbrcts_stats_ci_bca() -> "
-                 << "can't open one or more temporary files for writing:\n"
-                 << nbrcts_i_file[i] << "\n"
-                 << nbrcts_r_file[i] << "\n\n";
-
-            //
-            // Attempt to delete temp files
-            //
-            for(i=0; i<n_nbrcts; i++) {
-               remove_temp_file(nbrcts_i_file[i]);
-               remove_temp_file(nbrcts_r_file[i]);
-            }
-
-            // deallocate memory
-            if(nbrcts_tmp)    { delete [] nbrcts_tmp;    nbrcts_tmp    = (NBRCTSInfo *)   0; }
-             if(nbrcts_i_out)  { delete [] nbrcts_i_out;  nbrcts_i_out  = (ofstream *)     0; }
-            if(nbrcts_r_out)  { delete [] nbrcts_r_out;  nbrcts_r_out  = (ofstream *)     0; }
-            if(nbrcts_i_file) { delete [] nbrcts_i_file; nbrcts_i_file = (ConcatString *) 0; }
-            if(nbrcts_r_file) { delete [] nbrcts_r_file; nbrcts_r_file = (ConcatString *) 0; }
-
-            throw(1);
-         }
-      }
-
       //
       // Compute catgegorical stats from the raw data with the i-th data
-      // point removed and write out to a temp file
+      // point removed
       //
       for(i=0; i<n_nbrcts; i++) {
+#pragma omp parallel for schedule(dynamic)
          for(j=0; j<n; j++) {
-            compute_i_ctsinfo(pd, j, false, nbrcts_tmp[i].cts_info);
-            write_ctsinfo(nbrcts_i_out[i], nbrcts_tmp[i].cts_info);
+            CTSInfo cts_j = nbrcts_tmp[i].cts_info;
+            compute_i_ctsinfo(pd, j, false, cts_j);
+            store_ctsinfo(nbrcts_i_buf[i], j, cts_j);
          }
       } // end for i
 
       //
       // Resample the array of indices with replacement
       //
+#pragma omp parallel for schedule(dynamic) private(j) firstprivate(ir_na)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+         ran_sample_replicate(seeds, rngs, i, i_na, ir_na, n);
 
          //
          // Compute categorical stats for each replicate with the
          // nbrcts_flag flag set and the normal_ci_flag unset
          //
          for(j=0; j<n_nbrcts; j++) {
-            compute_ctsinfo(pd, ir_na, true, false,
-                            nbrcts_tmp[j].cts_info);
-            write_ctsinfo(nbrcts_r_out[j], nbrcts_tmp[j].cts_info);
+            CTSInfo cts_j = nbrcts_tmp[j].cts_info;
+            compute_ctsinfo(pd, ir_na, true, false, cts_j);
+            store_ctsinfo(nbrcts_r_buf[j], i, cts_j);
          } // end for j
       }
 
-      //
-      // Close the temp files
-      //
-      for(i=0; i<n_nbrcts; i++) {
-         nbrcts_i_out[i].close();
-         nbrcts_r_out[i].close();
-      }
-
       //
       // Compute bootstrap intervals for each threshold value
       //
@@ -2515,14 +2341,14 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          //
          // Initialize column counter
          //
-         c = 1;
+         c = 0;
 
          //
          // Compute bootstrap interval for baser
          //
          s = nbrcts_info[i].cts_info.baser.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2533,8 +2359,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for fmean
          //
          s = nbrcts_info[i].cts_info.fmean.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2545,8 +2371,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for acc
          //
          s = nbrcts_info[i].cts_info.acc.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2557,8 +2383,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for fbias
          //
          s = nbrcts_info[i].cts_info.fbias.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2569,8 +2395,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for pody
          //
          s = nbrcts_info[i].cts_info.pody.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2581,8 +2407,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for podn
          //
          s = nbrcts_info[i].cts_info.podn.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2593,8 +2419,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for pofd
          //
          s = nbrcts_info[i].cts_info.pofd.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2605,8 +2431,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for far
          //
          s = nbrcts_info[i].cts_info.far.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2617,8 +2443,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for csi
          //
          s = nbrcts_info[i].cts_info.csi.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2629,8 +2455,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for gss
          //
          s = nbrcts_info[i].cts_info.gss.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2641,8 +2467,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for hk
          //
          s = nbrcts_info[i].cts_info.hk.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2653,8 +2479,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for hss
          //
          s = nbrcts_info[i].cts_info.hss.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2665,8 +2491,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for odds
          //
          s = nbrcts_info[i].cts_info.odds.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2677,8 +2503,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for lodds
          //
          s = nbrcts_info[i].cts_info.lodds.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2689,8 +2515,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for orss
          //
          s = nbrcts_info[i].cts_info.orss.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2701,8 +2527,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for eds
          //
          s = nbrcts_info[i].cts_info.eds.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2713,8 +2539,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for seds
          //
          s = nbrcts_info[i].cts_info.seds.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2725,8 +2551,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for edi
          //
          s = nbrcts_info[i].cts_info.edi.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2737,8 +2563,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for sedi
          //
          s = nbrcts_info[i].cts_info.sedi.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2749,8 +2575,8 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for bagss
          //
          s = nbrcts_info[i].cts_info.bagss.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_i_buf[i], c,   si_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_bca_interval(s, si_na, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -2767,27 +2593,18 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
 
       mlog << Error << "\ncompute_nbrcts_stats_ci_bca() -> "
            << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+           << ".\n\n";
 
       exit(i_err);
    } // end catch block
 
-   //
-   // Delete temp files
-   //
-   for(i=0; i<n_nbrcts; i++) {
-      remove_temp_file(nbrcts_i_file[i]);
-      remove_temp_file(nbrcts_r_file[i]);
-   }
-
    //
    // Deallocate memory
    //
-   if(nbrcts_tmp)    { delete [] nbrcts_tmp;    nbrcts_tmp    = (NBRCTSInfo *)   0; }
-   if(nbrcts_i_out)  { delete [] nbrcts_i_out;  nbrcts_i_out  = (ofstream *)     0; }
-   if(nbrcts_r_out)  { delete [] nbrcts_r_out;  nbrcts_r_out  = (ofstream *)     0; }
-   if(nbrcts_i_file) { delete [] nbrcts_i_file; nbrcts_i_file = (ConcatString *) 0; }
-   if(nbrcts_r_file) { delete [] nbrcts_r_file; nbrcts_r_file = (ConcatString *) 0; }
+   free_replicate_rngs(rngs);
+   if(nbrcts_tmp)   { delete [] nbrcts_tmp;   nbrcts_tmp   = (NBRCTSInfo *)         0; }
+   if(nbrcts_i_buf) { delete [] nbrcts_i_buf; nbrcts_i_buf = (TwoD_Array<double> *) 0; }
+   if(nbrcts_r_buf) { delete [] nbrcts_r_buf; nbrcts_r_buf = (TwoD_Array<double> *) 0; }
 
    return;
 }
@@ -2807,10 +2624,11 @@ void compute_nbrcnt_stats_ci_bca(const gsl_rng *rng_ptr,
    NBRCNTInfo nbrcnt_tmp;
 
    //
-   // Temp file streams for continuous statistics
+   // Statistics for each point removed and each replicate
    //
-   ofstream nbrcnt_i_out, nbrcnt_r_out;
-   ConcatString nbrcnt_i_file, nbrcnt_r_file, prefix;
+   TwoD_Array<double> nbrcnt_i_buf, nbrcnt_r_buf;
+   vector<unsigned long> seeds;
+   vector<gsl_rng *> rngs;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -2842,73 +2660,59 @@ void compute_nbrcnt_stats_ci_bca(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !nbrcnt_flag) return;
 
    //
-   // Build the temp file names
+   // Allocate space to store the statistics for each point removed
+   // and each replicate
    //
-   prefix << cs_erase << tmp_dir << "/tmp_nbrcnt_i";
-   nbrcnt_i_file = make_temp_file_name(prefix.c_str(), NULL);
+   nbrcnt_i_buf.set_size(n_nbrcnt_stats, n);
+   nbrcnt_r_buf.set_size(n_nbrcnt_stats, b);
 
-   prefix << cs_erase << tmp_dir << "/tmp_nbrcnt_r";
-   nbrcnt_r_file = make_temp_file_name(prefix.c_str(), NULL);
+   //
+   // Draw the seed for each replicate up front so that the results
+   // do not depend on the number of threads
+   //
+   init_replicate_rngs(rng_ptr, b, seeds, rngs);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Enclose computations in a try block to catch any errors
    //
    try {
 
-      //
-      // Open up the temp files
-      //
-      nbrcnt_i_out.open(nbrcnt_i_file.c_str());
-      nbrcnt_r_out.open(nbrcnt_r_file.c_str());
-      if(!nbrcnt_i_out || !nbrcnt_r_out) {
-         mlog << Error << "\ncompute_nbrcnt_stats_ci_bca() -> "
-              << "can't open one or more temporary files for writing:\n"
-              << nbrcnt_i_file << "\n"
-              << nbrcnt_r_file << "\n\n";
-         throw(1);
-      }
-
       //
       // Compute continuous stats from the raw data with the i-th data
-      // point removed and write out to a temp file
+      // point removed
       //
+#pragma omp parallel for schedule(dynamic) firstprivate(nbrcnt_tmp)
       for(i=0; i<n; i++) {
          compute_i_nbrcntinfo(pd, pd_thr, i, nbrcnt_tmp);
-         write_nbrcntinfo(nbrcnt_i_out, nbrcnt_tmp);
+         store_nbrcntinfo(nbrcnt_i_buf, i, nbrcnt_tmp);
       }
 
       //
       // Resample the array of indices with replacement
       //
+#pragma omp parallel for schedule(dynamic) firstprivate(ir_na, nbrcnt_tmp)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+         ran_sample_replicate(seeds, rngs, i, i_na, ir_na, n);
 
          //
          // Compute continuous stats for each replicate
          //
          compute_nbrcntinfo(pd, pd_thr, ir_na, nbrcnt_tmp, 1);
-         write_nbrcntinfo(nbrcnt_r_out, nbrcnt_tmp);
+         store_nbrcntinfo(nbrcnt_r_buf, i, nbrcnt_tmp);
       }
 
-      //
-      // Close the temp files
-      //
-      nbrcnt_i_out.close();
-      nbrcnt_r_out.close();
-
       //
       // Initialize column counter
       //
-      c = 1;
+      c = 0;
 
       //
       // Compute bootstrap interval for FBS
       //
       s = nbrcnt_info.fbs.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
+      read_column(nbrcnt_i_buf, c,   si_na);
+      read_column(nbrcnt_r_buf, c++, sr_na);
       for(i=0; i<nbrcnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               nbrcnt_info.alpha[i],
@@ -2919,8 +2723,8 @@ void compute_nbrcnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for FSS
       //
       s = nbrcnt_info.fss.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
+      read_column(nbrcnt_i_buf, c,   si_na);
+      read_column(nbrcnt_r_buf, c++, sr_na);
       for(i=0; i<nbrcnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               nbrcnt_info.alpha[i],
@@ -2931,8 +2735,8 @@ void compute_nbrcnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for AFSS
       //
       s = nbrcnt_info.afss.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
+      read_column(nbrcnt_i_buf, c,   si_na);
+      read_column(nbrcnt_r_buf, c++, sr_na);
       for(i=0; i<nbrcnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               nbrcnt_info.alpha[i],
@@ -2943,8 +2747,8 @@ void compute_nbrcnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for UFSS
       //
       s = nbrcnt_info.ufss.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
+      read_column(nbrcnt_i_buf, c,   si_na);
+      read_column(nbrcnt_r_buf, c++, sr_na);
       for(i=0; i<nbrcnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               nbrcnt_info.alpha[i],
@@ -2955,8 +2759,8 @@ void compute_nbrcnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for F_RATE
       //
       s = nbrcnt_info.f_rate.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
+      read_column(nbrcnt_i_buf, c,   si_na);
+      read_column(nbrcnt_r_buf, c++, sr_na);
       for(i=0; i<nbrcnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               nbrcnt_info.alpha[i],
@@ -2967,8 +2771,8 @@ void compute_nbrcnt_stats_ci_bca(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for O_RATE
       //
       s = nbrcnt_info.o_rate.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
+      read_column(nbrcnt_i_buf, c,   si_na);
+      read_column(nbrcnt_r_buf, c++, sr_na);
       for(i=0; i<nbrcnt_info.n_alpha; i++)
          compute_bca_interval(s, si_na, sr_na,
                               nbrcnt_info.alpha[i],
@@ -2984,22 +2788,15 @@ void compute_nbrcnt_stats_ci_bca(const gsl_rng *rng_ptr,
 
       mlog << Error << "\ncompute_nbrcnt_stats_ci_bca() -> "
            << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
-
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(nbrcnt_i_file);
-      remove_temp_file(nbrcnt_r_file);
+           << ".\n\n";
 
       exit(i_err);
    } // end catch block
 
    //
-   // Delete temp files
+   // Deallocate memory
    //
-   remove_temp_file(nbrcnt_i_file);
-   remove_temp_file(nbrcnt_r_file);
+   free_replicate_rngs(rngs);
 
    return;
 }
@@ -3019,10 +2816,11 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
    NBRCTSInfo *nbrcts_tmp = ( NBRCTSInfo *) 0;
 
    //
-   // Temp file streams for categorical statistics
+   // Categorical statistics for each replicate
    //
-   ofstream *nbrcts_r_out = (ofstream *) 0;
-   ConcatString *nbrcts_r_file = (ConcatString *) 0, prefix;
+   TwoD_Array<double> *nbrcts_r_buf = (TwoD_Array<double> *) 0;
+   vector<unsigned long> seeds;
+   vector<gsl_rng *> rngs;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -3059,80 +2857,49 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
 
    //
    // Allocate space to store categorical stats for each threshold
-   // and for the output temp file streams
+   // and for each replicate
    //
-   nbrcts_tmp    = new NBRCTSInfo [n_nbrcts];
-   nbrcts_r_out  = new ofstream [n_nbrcts];
-   nbrcts_r_file = new ConcatString [n_nbrcts];
+   nbrcts_tmp   = new NBRCTSInfo         [n_nbrcts];
+   nbrcts_r_buf = new TwoD_Array<double> [n_nbrcts];
    for(i=0; i<n_nbrcts; i++) {
       nbrcts_tmp[i].cts_info.fthresh = nbrcts_info[i].cts_info.fthresh;
       nbrcts_tmp[i].cts_info.othresh = nbrcts_info[i].cts_info.othresh;
       nbrcts_tmp[i].fthresh          = nbrcts_info[i].fthresh;
       nbrcts_tmp[i].othresh          = nbrcts_info[i].othresh;
       nbrcts_tmp[i].cthresh          = nbrcts_info[i].cthresh;
+      nbrcts_r_buf[i].set_size(n_cts_stats, b);
    }
 
    //
-   // Build the temp file names
+   // Draw the seed for each replicate up front so that the results
+   // do not depend on the number of threads
    //
-   for(i=0; i<n_nbrcts; i++) {
-      prefix << cs_erase << tmp_dir << "/tmp_nbrcts_r_" << i;
-      nbrcts_r_file[i] = make_temp_file_name(prefix.c_str(), NULL);
-   }
+   init_replicate_rngs(rng_ptr, b, seeds, rngs);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Enclose computations in a try block to catch any errors
    //
    try {
 
-      //
-      // Open up the temp files
-      //
-      for(i=0; i<n_nbrcts; i++) {
-         nbrcts_r_out[i].open(nbrcts_r_file[i].c_str());
-         if(!nbrcts_r_out[i]) {
-            mlog << Error << "\ncompute_nbrcts_stats_ci_perc() -> "
-                 << "can't open the temporary file for writing:\n"
-                 << nbrcts_r_file[i] << "\n\n";
-
-            //
-          // Attempt to delete temp files
-          //
-          for(i=0; i<n_nbrcts; i++) remove_temp_file(nbrcts_r_file[i]);
-         // Deallocate memory
-         //
-         if(nbrcts_tmp)    { delete [] nbrcts_tmp;    nbrcts_tmp    = (NBRCTSInfo *)   0; }
-         if(nbrcts_r_out)  { delete [] nbrcts_r_out;  nbrcts_r_out  = (ofstream *)     0; }
-         if(nbrcts_r_file) { delete [] nbrcts_r_file; nbrcts_r_file = (ConcatString *) 0; }
-
-            throw(1);
-         }
-      }
-
       //
       // Resample the array of indices with replacement
       //
+#pragma omp parallel for schedule(dynamic) private(j) firstprivate(ir_na)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+         ran_sample_replicate(seeds, rngs, i, i_na, ir_na, n);
 
          //
          // Compute categorical stats for each replicate with the
          // nbrcts_flag set and the normal_ci_flag unset
          //
          for(j=0; j<n_nbrcts; j++) {
-            compute_ctsinfo(pd, ir_na, true, false,
-                            nbrcts_tmp[j].cts_info);
-            write_ctsinfo(nbrcts_r_out[j], nbrcts_tmp[j].cts_info);
+            CTSInfo cts_j = nbrcts_tmp[j].cts_info;
+            compute_ctsinfo(pd, ir_na, true, false, cts_j);
+            store_ctsinfo(nbrcts_r_buf[j], i, cts_j);
          } // end for j
       }
 
-      //
-      // Close the temp files
-      //
-      for(i=0; i<n_nbrcts; i++) nbrcts_r_out[i].close();
-
       //
       // Compute bootstrap intervals for each threshold value
       //
@@ -3141,13 +2908,13 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          //
          // Initialize column counter
          //
-         c = 1;
+         c = 0;
 
          //
          // Compute bootstrap interval for baser
          //
          s = nbrcts_info[i].cts_info.baser.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3158,7 +2925,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for fmean
          //
          s = nbrcts_info[i].cts_info.fmean.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3169,7 +2936,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for acc
          //
          s = nbrcts_info[i].cts_info.acc.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3180,7 +2947,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for fbias
          //
          s = nbrcts_info[i].cts_info.fbias.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3191,7 +2958,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for pody
          //
          s = nbrcts_info[i].cts_info.pody.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3202,7 +2969,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for podn
          //
          s = nbrcts_info[i].cts_info.podn.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3213,7 +2980,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for pofd
          //
          s = nbrcts_info[i].cts_info.pofd.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3224,7 +2991,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for far
          //
          s = nbrcts_info[i].cts_info.far.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3235,7 +3002,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for csi
          //
          s = nbrcts_info[i].cts_info.csi.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3246,7 +3013,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for gss
          //
          s = nbrcts_info[i].cts_info.gss.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3257,7 +3024,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for hk
          //
          s = nbrcts_info[i].cts_info.hk.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3268,7 +3035,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for hss
          //
          s = nbrcts_info[i].cts_info.hss.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3279,7 +3046,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for odds
          //
          s = nbrcts_info[i].cts_info.odds.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                   nbrcts_info[i].cts_info.alpha[j],
@@ -3290,7 +3057,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for lodds
          //
          s = nbrcts_info[i].cts_info.lodds.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -3301,7 +3068,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for orss
          //
          s = nbrcts_info[i].cts_info.orss.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -3312,7 +3079,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for eds
          //
          s = nbrcts_info[i].cts_info.eds.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -3323,7 +3090,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for seds
          //
          s = nbrcts_info[i].cts_info.seds.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -3334,7 +3101,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for edi
          //
          s = nbrcts_info[i].cts_info.edi.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -3345,7 +3112,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for sedi
          //
          s = nbrcts_info[i].cts_info.sedi.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -3356,7 +3123,7 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
          // Compute bootstrap interval for bagss
          //
          s = nbrcts_info[i].cts_info.bagss.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
+         read_column(nbrcts_r_buf[i], c++, sr_na);
          for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
             compute_perc_interval(s, sr_na,
                                  nbrcts_info[i].cts_info.alpha[j],
@@ -3373,24 +3140,17 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
 
       mlog << Error << "\ncompute_nbrcts_stats_ci_perc() -> "
            << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+           << ".\n\n";
 
       exit(i_err);
    } // end catch block
 
-   //
-   // Delete temp files
-   //
-   for(i=0; i<n_nbrcts; i++) {
-      remove_temp_file(nbrcts_r_file[i]);
-   }
-
    //
    // Deallocate memory
    //
-   if(nbrcts_tmp)    { delete [] nbrcts_tmp;    nbrcts_tmp    = (NBRCTSInfo *)   0; }
-   if(nbrcts_r_out)  { delete [] nbrcts_r_out;  nbrcts_r_out  = (ofstream *)     0; }
-   if(nbrcts_r_file) { delete [] nbrcts_r_file; nbrcts_r_file = (ConcatString *) 0; }
+   free_replicate_rngs(rngs);
+   if(nbrcts_tmp)   { delete [] nbrcts_tmp;   nbrcts_tmp   = (NBRCTSInfo *)         0; }
+   if(nbrcts_r_buf) { delete [] nbrcts_r_buf; nbrcts_r_buf = (TwoD_Array<double> *) 0; }
 
    return;
 }
@@ -3411,10 +3171,11 @@ void compute_nbrcnt_stats_ci_perc(const gsl_rng *rng_ptr,
    NBRCNTInfo nbrcnt_tmp;
 
    //
-   // Temp file streams for continuous statistics
+   // Statistics for each replicate
    //
-   ofstream nbrcnt_r_out;
-   ConcatString nbrcnt_r_file, prefix;
+   TwoD_Array<double> nbrcnt_r_buf;
+   vector<unsigned long> seeds;
+   vector<gsl_rng *> rngs;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -3446,57 +3207,46 @@ void compute_nbrcnt_stats_ci_perc(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !nbrcnt_flag) return;
 
    //
-   // Build the temp file names
+   // Allocate space to store the statistics for each replicate
    //
-   prefix << cs_erase << tmp_dir << "/tmp_nbrcnt_r";
-   nbrcnt_r_file = make_temp_file_name(prefix.c_str(), NULL);
+   nbrcnt_r_buf.set_size(n_nbrcnt_stats, b);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Draw the seed for each replicate up front so that the results
+   // do not depend on the number of threads
    //
-   try {
+   init_replicate_rngs(rng_ptr, b, seeds, rngs);
 
-      //
-      // Open up the temp files
-      //
-      nbrcnt_r_out.open(nbrcnt_r_file.c_str());
-      if(!nbrcnt_r_out) {
-         mlog << Error << "\ncompute_nbrcnt_stats_ci_perc() -> "
-              << "can't open the temporary file for writing:\n"
-              << nbrcnt_r_file << "\n\n";
-         throw(1);
-      }
+   //
+   // Enclose computations in a try block to catch any errors
+   //
+   try {
 
       //
       // Resample the array of indices with replacement
       //
+#pragma omp parallel for schedule(dynamic) firstprivate(ir_na, nbrcnt_tmp)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+         ran_sample_replicate(seeds, rngs, i, i_na, ir_na, n);
 
          //
          // Compute continuous stats for each replicate
          //
          compute_nbrcntinfo(pd, pd_thr, ir_na, nbrcnt_tmp, 1);
-         write_nbrcntinfo(nbrcnt_r_out, nbrcnt_tmp);
+         store_nbrcntinfo(nbrcnt_r_buf, i, nbrcnt_tmp);
       }
 
-      //
-      // Close the temp files
-      //
-      nbrcnt_r_out.close();
-
       //
       // Initialize column counter
       //
-      c = 1;
+      c = 0;
 
       //
       // Compute bootstrap interval for FBS
       //
       s = nbrcnt_info.fbs.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
+      read_column(nbrcnt_r_buf, c++, sr_na);
       for(i=0; i<nbrcnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                               nbrcnt_info.alpha[i],
@@ -3507,7 +3257,7 @@ void compute_nbrcnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for FSS
       //
       s = nbrcnt_info.fss.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
+      read_column(nbrcnt_r_buf, c++, sr_na);
       for(i=0; i<nbrcnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                               nbrcnt_info.alpha[i],
@@ -3518,7 +3268,7 @@ void compute_nbrcnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for AFSS
       //
       s = nbrcnt_info.afss.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
+      read_column(nbrcnt_r_buf, c++, sr_na);
       for(i=0; i<nbrcnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                               nbrcnt_info.alpha[i],
@@ -3529,7 +3279,7 @@ void compute_nbrcnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for UFSS
       //
       s = nbrcnt_info.ufss.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
+      read_column(nbrcnt_r_buf, c++, sr_na);
       for(i=0; i<nbrcnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                               nbrcnt_info.alpha[i],
@@ -3540,7 +3290,7 @@ void compute_nbrcnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for F_RATE
       //
       s = nbrcnt_info.f_rate.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
+      read_column(nbrcnt_r_buf, c++, sr_na);
       for(i=0; i<nbrcnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                               nbrcnt_info.alpha[i],
@@ -3551,7 +3301,7 @@ void compute_nbrcnt_stats_ci_perc(const gsl_rng *rng_ptr,
       // Compute bootstrap interval for O_RATE
       //
       s = nbrcnt_info.o_rate.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
+      read_column(nbrcnt_r_buf, c++, sr_na);
       for(i=0; i<nbrcnt_info.n_alpha; i++)
          compute_perc_interval(s, sr_na,
                               nbrcnt_info.alpha[i],
@@ -3567,20 +3317,15 @@ void compute_nbrcnt_stats_ci_perc(const gsl_rng *rng_ptr,
 
       mlog << Error << "\ncompute_nbrcnt_stats_ci_perc() -> "
            << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
-
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(nbrcnt_r_file);
+           << ".\n\n";
 
       exit(i_err);
    } // end catch block
 
    //
-   // Delete temp files
+   // Deallocate memory
    //
-   remove_temp_file(nbrcnt_r_file);
+   free_replicate_rngs(rngs);
 
    return;
 }
@@ -3849,106 +3594,124 @@ void compute_perc_interval(double s, NumArray &sr_na,
    return;
 }
 
-////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void write_cntinfo(ofstream &tmp_out, const CNTInfo &c) {
-   char line[max_line_len];
+void store_cntinfo(TwoD_Array<double> &buf, int row, const CNTInfo &c) {
+   const double v[n_cnt_stats] = {
+      c.fbar.v,    c.fstdev.v,    c.obar.v,          c.ostdev.v,
+      c.pr_corr.v, c.anom_corr.v,
+      c.rmsfa.v,   c.rmsoa.v,     c.anom_corr_uncntr.v,
+      c.me.v,      c.me2.v,       c.estdev.v,        c.mbias.v,
+      c.mae.v,     c.mse.v,       c.msess.v,         c.bcmse.v,
+      c.rmse.v,    c.e10.v,       c.e25.v,           c.e50.v,
+      c.e75.v,     c.e90.v,       c.eiqr.v,          c.mad.v };
 
-   snprintf(line, max_line_len,
-           "%f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f",
-           c.fbar.v,    c.fstdev.v,    c.obar.v,          c.ostdev.v,
-           c.pr_corr.v, c.anom_corr.v,
-           c.rmsfa.v,   c.rmsoa.v,     c.anom_corr_uncntr.v,
-           c.me.v,      c.me2.v,       c.estdev.v,        c.mbias.v,
-           c.mae.v,     c.mse.v,       c.msess.v,         c.bcmse.v,
-           c.rmse.v,    c.e10.v,       c.e25.v,           c.e50.v,
-           c.e75.v,     c.e90.v,       c.eiqr.v,          c.mad.v);
+   for(int i=0; i<n_cnt_stats; i++) buf.put(v[i], i, row);
 
-   tmp_out << line << "\n";
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void store_ctsinfo(TwoD_Array<double> &buf, int row, const CTSInfo &c) {
+   const double v[n_cts_stats] = {
+      c.baser.v,   c.fmean.v,   c.acc.v,     c.fbias.v,
+      c.pody.v,    c.podn.v,    c.pofd.v,    c.far.v,
+      c.csi.v,     c.gss.v,     c.hk.v,      c.hss.v,
+      c.odds.v,    c.lodds.v,   c.orss.v,    c.eds.v,
+      c.seds.v,    c.edi.v,     c.sedi.v,    c.bagss.v };
+
+   for(int i=0; i<n_cts_stats; i++) buf.put(v[i], i, row);
 
    return;
 }
 
 ////////////////////////////////////////////////////////////////////////
 
-void write_ctsinfo(ofstream &tmp_out, const CTSInfo &c) {
-   char line[max_line_len];
+void store_mctsinfo(TwoD_Array<double> &buf, int row, const MCTSInfo &c) {
+   const double v[n_mcts_stats] = {
+      c.acc.v, c.hk.v, c.hss.v, c.ger.v };
+
+   for(int i=0; i<n_mcts_stats; i++) buf.put(v[i], i, row);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
 
-   snprintf(line, max_line_len,
-           "%f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f",
-           c.baser.v,   c.fmean.v,   c.acc.v,     c.fbias.v,
-           c.pody.v,    c.podn.v,    c.pofd.v,    c.far.v,
-           c.csi.v,     c.gss.v,     c.hk.v,      c.hss.v,
-           c.odds.v,    c.lodds.v,   c.orss.v,    c.eds.v,
-           c.seds.v,    c.edi.v,     c.sedi.v,    c.bagss.v
-          );
+void store_nbrcntinfo(TwoD_Array<double> &buf, int row, const NBRCNTInfo &c) {
+   const double v[n_nbrcnt_stats] = {
+      c.fbs.v, c.fss.v, c.afss.v, c.ufss.v, c.f_rate.v, c.o_rate.v };
 
-   tmp_out << line << "\n";
+   for(int i=0; i<n_nbrcnt_stats; i++) buf.put(v[i], i, row);
 
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Store the valid values in the column specified, in row order.
+//
 ////////////////////////////////////////////////////////////////////////
 
-void write_mctsinfo(ofstream &tmp_out, const MCTSInfo &c) {
-   char line[max_line_len];
+void read_column(const TwoD_Array<double> &buf, int col, NumArray &na) {
+   double v;
 
-   snprintf(line, max_line_len, "%f %f %f %f",
-           c.acc.v, c.hk.v, c.hss.v, c.ger.v);
+   na.clear();
+   na.extend(buf.ny());
 
-   tmp_out << line << "\n";
+   for(int i=0; i<buf.ny(); i++) {
+      v = buf(col, i);
+      if(!is_bad_data(v)) na.add(v);
+   }
 
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Draw one seed per replicate from the input random number generator
+// and allocate one generator per thread.  Each replicate reseeds the
+// generator of the thread processing it, so the resampled indices
+// depend only on the replicate number and not on the thread count.
+//
 ////////////////////////////////////////////////////////////////////////
 
-void write_nbrcntinfo(ofstream &tmp_out, const NBRCNTInfo &c) {
-   char line[max_line_len];
+void init_replicate_rngs(const gsl_rng *rng_ptr, int b,
+                         vector<unsigned long> &seeds,
+                         vector<gsl_rng *> &rngs) {
+   int i;
 
-   snprintf(line, max_line_len,
-           "%f %f %f %f %f %f",
-           c.fbs.v, c.fss.v, c.afss.v, c.ufss.v, c.f_rate.v, c.o_rate.v);
+   seeds.resize(b);
+   for(i=0; i<b; i++) seeds[i] = rng_get(rng_ptr);
 
-   tmp_out << line << "\n";
+   rngs.assign(met_num_threads(), (gsl_rng *) 0);
+   for(i=0; i<(int) rngs.size(); i++) rng_clone(rngs[i], rng_ptr);
 
    return;
 }
 
 ////////////////////////////////////////////////////////////////////////
 
-void read_ldf(const ConcatString file_name, int col, NumArray &na) {
-   LineDataFile ldf_in;
-   DataLine line;
-   double v;
+void free_replicate_rngs(vector<gsl_rng *> &rngs) {
 
-   //
-   // Open up the input file for reading
-   //
-   if(!ldf_in.open(file_name.c_str())) {
-      mlog << Error << "\nread_ldf() -> "
-           << "can't open file: " << file_name << "\n\n"
-          ;
-      throw(1);
+   for(int i=0; i<(int) rngs.size(); i++) {
+      if(rngs[i]) rng_free(rngs[i]);
    }
+   rngs.clear();
 
-   //
-   // Clear out the NumArray
-   //
-   na.clear();
+   return;
+}
 
-   //
-   // Read the data in the column specified
-   //
-   while(ldf_in >> line) {
-      v = atof(line.get_item(col-1));
-      if(!is_bad_data(v)) na.add(v);
-   }
+////////////////////////////////////////////////////////////////////////
 
-   //
-   // Close the input file
-   //
-   ldf_in.close();
+void ran_sample_replicate(const vector<unsigned long> &seeds,
+                          const vector<gsl_rng *> &rngs, int i_rep,
+                          NumArray &i_na, NumArray &ir_na, int m) {
+   const gsl_rng *r = rngs[met_thread_num()];
+
+   rng_seed(r, seeds[i_rep]);
+   ran_sample(r, i_na, ir_na, m);
 
    return;
 }
@@ -881,14 +881,8 @@ void VxPairDataPoint::add_point_obs(float *hdr_arr, const char *hdr_typ_str,
                                     const char *obs_qty, float *obs_arr,
                                     Grid &gr, const char *var_name,
                                     const DataPlane *wgt_dp) {
-   int i, j, k, x, y;
-   double hdr_lat, hdr_lon, hdr_elv;
-   double obs_x, obs_y, obs_lvl, obs_hgt, to_lvl;
-   double fcst_v, cmn_v, csd_v, obs_v, wgt_v;
-   int f_lvl_blw, f_lvl_abv;
-   int cmn_lvl_blw, cmn_lvl_abv;
-   int csd_lvl_blw, csd_lvl_abv;
-   ConcatString reason_cs;
+   int i;
+   double obs_x, obs_y;
 
    // Increment the number of tries count
    n_try++;
@@ -932,6 +926,107 @@ void VxPairDataPoint::add_point_obs(float *hdr_arr, const char *hdr_typ_str,
       return;
    }
 
+   // Convert the lat/lon value to x/y
+   gr.latlon_to_xy((double) hdr_arr[0], -1.0*hdr_arr[1], obs_x, obs_y);
+
+   add_point_pairs(hdr_arr, hdr_typ_str, hdr_sid_str, hdr_ut, obs_qty,
+                   obs_arr, obs_x, obs_y, gr.nx(), gr.ny(), var_name,
+                   wgt_dp);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void VxPairDataPoint::add_point_obs(const PointObsTable &tbl,
+                                    const DataPlane *wgt_dp) {
+   int i, j, i_obs, i_hdr, n_rej_sid;
+   float hdr_arr[point_obs_hdr_arr_len], obs_arr[point_obs_arr_len];
+   vector<char> sid_ok(tbl.n_sid()), qty_ok(tbl.n_qty());
+   vector<int> obs_idx;
+
+   // Increment the number of tries count
+   n_try += tbl.n_obs();
+
+   // Check the station ID inclusion and exclusion lists once for
+   // each station
+   for(i=0, n_rej_sid=0; i<tbl.n_sid(); i++) {
+      sid_ok[i] = !((sid_inc_filt.n() && !sid_inc_filt.has(tbl.sid_str(i))) ||
+                    (sid_exc_filt.n() &&  sid_exc_filt.has(tbl.sid_str(i))));
+      if(!sid_ok[i]) n_rej_sid += tbl.sid_n_obs(i);
+   }
+   rej_sid += n_rej_sid;
+
+   // Check the observation quality flags once for each flag value
+   for(i=0; i<tbl.n_qty(); i++) {
+      qty_ok[i] = true;
+      if(obs_qty_filt.n() && strcmp(tbl.qty_str(i), "")) {
+         qty_ok[i] = false;
+         for(j=0; j<obs_qty_filt.n() && !qty_ok[i]; j++) {
+            if(tbl.qty_str(i) == obs_qty_filt[j]) qty_ok[i] = true;
+         }
+      }
+   }
+
+   // Only the observations for this variable are candidates
+   tbl.select_obs(obs_info->name().c_str(), obs_info->code(), obs_idx);
+
+   // All other observations with a valid station ID are rejected
+   // based on their variable
+   rej_var += tbl.n_obs() - n_rej_sid;
+
+   for(i=0; i<(int) obs_idx.size(); i++) {
+
+      i_obs = obs_idx[i];
+      i_hdr = tbl.obs_hdr(i_obs);
+
+      if(!sid_ok[tbl.hdr_sid(i_hdr)]) continue;
+
+      rej_var--;
+
+      if(!qty_ok[tbl.obs_qty(i_obs)]) {
+         rej_qty++;
+         continue;
+      }
+
+      if(tbl.hdr_ut(i_hdr) < beg_ut || tbl.hdr_ut(i_hdr) > end_ut) {
+         rej_vld++;
+         continue;
+      }
+
+      tbl.get_arrays(i_obs, hdr_arr, obs_arr);
+
+      add_point_pairs(hdr_arr, tbl.hdr_typ_str(i_hdr),
+                      tbl.hdr_sid_str(i_hdr), tbl.hdr_ut(i_hdr),
+                      tbl.obs_qty_str(i_obs), obs_arr,
+                      tbl.hdr_x(i_hdr), tbl.hdr_y(i_hdr),
+                      tbl.grid_nx(), tbl.grid_ny(),
+                      tbl.obs_var_str(i_obs), wgt_dp);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void VxPairDataPoint::add_point_pairs(float *hdr_arr,
+                                      const char *hdr_typ_str,
+                                      const char *hdr_sid_str,
+                                      unixtime hdr_ut,
+                                      const char *obs_qty, float *obs_arr,
+                                      double obs_x, double obs_y,
+                                      int grid_nx, int grid_ny,
+                                      const char *var_name,
+                                      const DataPlane *wgt_dp) {
+   int i, j, k, x, y;
+   double hdr_lat, hdr_lon, hdr_elv;
+   double obs_lvl, obs_hgt, to_lvl;
+   double fcst_v, cmn_v, csd_v, obs_v, wgt_v;
+   int f_lvl_blw, f_lvl_abv;
+   int cmn_lvl_blw, cmn_lvl_abv;
+   int csd_lvl_blw, csd_lvl_abv;
+   ConcatString reason_cs;
+
    hdr_lat = hdr_arr[0];
    hdr_lon = hdr_arr[1];
    hdr_elv = hdr_arr[2];
@@ -955,20 +1050,18 @@ void VxPairDataPoint::add_point_obs(float *hdr_arr, const char *hdr_typ_str,
       return;
    }
 
-   // Convert the lat/lon value to x/y
-   gr.latlon_to_xy(hdr_lat, -1.0*hdr_lon, obs_x, obs_y);
    x = nint(obs_x);
    y = nint(obs_y);
 
    // Check if the observation's lat/lon is on the grid
-   if(x < 0 || x >= gr.nx() ||
-      y < 0 || y >= gr.ny()) {
+   if(x < 0 || x >= grid_nx ||
+      y < 0 || y >= grid_ny) {
       mlog << Debug(4)
            << "For " << fcst_info->magic_str() << " versus "
            << obs_info->magic_str()
            << ", skipping observation off the grid where (x, y) = ("
-           << x << ", " << y << ") and grid (nx, ny) = (" << gr.nx()
-           << ", " << gr.ny() << "):\n"
+           << x << ", " << y << ") and grid (nx, ny) = (" << grid_nx
+           << ", " << grid_ny << "):\n"
            << point_obs_to_string(hdr_arr, hdr_typ_str, hdr_sid_str,
                                   hdr_ut, obs_qty, obs_arr, var_name)
            << "\n";
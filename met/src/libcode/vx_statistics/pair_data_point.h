@@ -12,6 +12,7 @@
 ////////////////////////////////////////////////////////////////////////
 
 #include "pair_base.h"
+#include "point_obs_table.h"
 
 #include "vx_util.h"
 #include "vx_grid.h"
@@ -84,6 +85,10 @@ class VxPairDataPoint {
       void init_from_scratch();
       void assign(const VxPairDataPoint &);
 
+      void add_point_pairs(float *, const char *, const char *, unixtime,
+                           const char *, float *, double, double, int, int,
+                           const char *, const DataPlane *);
+
    public:
 
       VxPairDataPoint();
@@ -229,6 +234,9 @@ class VxPairDataPoint {
                          const char *, float *, Grid &, const char * = 0,
                          const DataPlane * = 0);
 
+      // Add all of the observations from the table, in order
+      void add_point_obs(const PointObsTable &, const DataPlane * = 0);
+
       int  get_n_pair() const;
 
       void set_duplicate_flag(DuplicateType duplicate_flag);
@@ -0,0 +1,336 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+#include "point_obs_table.h"
+
+#include "vx_log.h"
+#include "vx_math.h"
+
+////////////////////////////////////////////////////////////////////////
+//
+// Code for class PointObsTable
+//
+////////////////////////////////////////////////////////////////////////
+
+PointObsTable::PointObsTable() {
+   init_from_scratch();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+PointObsTable::~PointObsTable() {
+   clear();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+PointObsTable::PointObsTable(const PointObsTable &t) {
+
+   init_from_scratch();
+
+   assign(t);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+PointObsTable & PointObsTable::operator=(const PointObsTable &t) {
+
+   if(this == &t) return(*this);
+
+   assign(t);
+
+   return(*this);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void PointObsTable::init_from_scratch() {
+
+   clear();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void PointObsTable::clear() {
+
+   HdrLat.clear();
+   HdrLon.clear();
+   HdrElv.clear();
+   HdrTyp.clear();
+   HdrSid.clear();
+   HdrUt.clear();
+   HdrX.clear();
+   HdrY.clear();
+
+   ObsHdr.clear();
+   ObsVar.clear();
+   ObsCode.clear();
+   ObsLvl.clear();
+   ObsHgt.clear();
+   ObsVal.clear();
+   ObsQty.clear();
+
+   TypDict.clear();
+   SidDict.clear();
+   VarDict.clear();
+   QtyDict.clear();
+
+   TypIndex.clear();
+   SidIndex.clear();
+   VarIndex.clear();
+   QtyIndex.clear();
+
+   VarObs.clear();
+   CodeObs.clear();
+
+   SidNObs.clear();
+
+   GridNx = GridNy = 0;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void PointObsTable::assign(const PointObsTable &t) {
+
+   clear();
+
+   HdrLat  = t.HdrLat;
+   HdrLon  = t.HdrLon;
+   HdrElv  = t.HdrElv;
+   HdrTyp  = t.HdrTyp;
+   HdrSid  = t.HdrSid;
+   HdrUt   = t.HdrUt;
+   HdrX    = t.HdrX;
+   HdrY    = t.HdrY;
+
+   ObsHdr  = t.ObsHdr;
+   ObsVar  = t.ObsVar;
+   ObsCode = t.ObsCode;
+   ObsLvl  = t.ObsLvl;
+   ObsHgt  = t.ObsHgt;
+   ObsVal  = t.ObsVal;
+   ObsQty  = t.ObsQty;
+
+   TypDict = t.TypDict;
+   SidDict = t.SidDict;
+   VarDict = t.VarDict;
+   QtyDict = t.QtyDict;
+
+   TypIndex = t.TypIndex;
+   SidIndex = t.SidIndex;
+   VarIndex = t.VarIndex;
+   QtyIndex = t.QtyIndex;
+
+   VarObs  = t.VarObs;
+   CodeObs = t.CodeObs;
+
+   SidNObs = t.SidNObs;
+
+   GridNx = t.GridNx;
+   GridNy = t.GridNy;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+int PointObsTable::intern(const char *str, vector<string> &dict,
+                          map<string,int> &index) {
+   string s = (str ? str : "");
+
+   map<string,int>::const_iterator it = index.find(s);
+
+   if(it != index.end()) return(it->second);
+
+   int i = (int) dict.size();
+
+   dict.push_back(s);
+   index[s] = i;
+
+   return(i);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+int PointObsTable::add_hdr(float lat, float lon, float elv,
+                           const char *typ, const char *sid,
+                           unixtime ut) {
+   int i_sid = intern(sid, SidDict, SidIndex);
+
+   if(i_sid >= (int) SidNObs.size()) SidNObs.push_back(0);
+
+   HdrLat.push_back(lat);
+   HdrLon.push_back(lon);
+   HdrElv.push_back(elv);
+   HdrTyp.push_back(intern(typ, TypDict, TypIndex));
+   HdrSid.push_back(i_sid);
+   HdrUt.push_back(ut);
+
+   return(n_hdr() - 1);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void PointObsTable::add_obs(int i_hdr, const char *var_name, float code,
+                            float lvl, float hgt, float val,
+                            const char *qty) {
+   int i_var = -1;
+
+   if(i_hdr < 0 || i_hdr >= n_hdr()) {
+      mlog << Error << "\nPointObsTable::add_obs() -> "
+           << "range check error for header index " << i_hdr << "\n\n";
+      exit(1);
+   }
+
+   // Index the observation by variable name or GRIB code
+   if(var_name && *var_name) {
+      i_var = intern(var_name, VarDict, VarIndex);
+      if(i_var >= (int) VarObs.size()) VarObs.resize(i_var + 1);
+      VarObs[i_var].push_back(n_obs());
+   }
+   else {
+      CodeObs[nint(code)].push_back(n_obs());
+   }
+
+   SidNObs[HdrSid[i_hdr]]++;
+
+   ObsHdr.push_back(i_hdr);
+   ObsVar.push_back(i_var);
+   ObsCode.push_back(code);
+   ObsLvl.push_back(lvl);
+   ObsHgt.push_back(hgt);
+   ObsVal.push_back(val);
+   ObsQty.push_back(intern(qty, QtyDict, QtyIndex));
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void PointObsTable::set_grid(const Grid &gr) {
+   int i;
+
+   GridNx = gr.nx();
+   GridNy = gr.ny();
+
+   HdrX.resize(n_hdr());
+   HdrY.resize(n_hdr());
+
+   // Convert each header lat/lon to grid x/y only once
+   for(i=0; i<n_hdr(); i++) {
+      gr.latlon_to_xy((double) HdrLat[i], -1.0*HdrLon[i], HdrX[i], HdrY[i]);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bigint PointObsTable::n_bytes() const {
+   bigint n;
+   int i;
+
+   n = (bigint) HdrLat.capacity()*sizeof(float)
+     + (bigint) HdrLon.capacity()*sizeof(float)
+     + (bigint) HdrElv.capacity()*sizeof(float)
+     + (bigint) HdrTyp.capacity()*sizeof(int)
+     + (bigint) HdrSid.capacity()*sizeof(int)
+     + (bigint) HdrUt.capacity()*sizeof(unixtime)
+     + (bigint) HdrX.capacity()*sizeof(double)
+     + (bigint) HdrY.capacity()*sizeof(double);
+
+   n += (bigint) ObsHdr.capacity()*sizeof(int)
+      + (bigint) ObsVar.capacity()*sizeof(int)
+      + (bigint) ObsCode.capacity()*sizeof(float)
+      + (bigint) ObsLvl.capacity()*sizeof(float)
+      + (bigint) ObsHgt.capacity()*sizeof(float)
+      + (bigint) ObsVal.capacity()*sizeof(float)
+      + (bigint) ObsQty.capacity()*sizeof(int);
+
+   // Each string is stored in the dictionary and its index
+   for(i=0; i<(int) TypDict.size(); i++) n += 2*TypDict[i].capacity();
+   for(i=0; i<(int) SidDict.size(); i++) n += 2*SidDict[i].capacity();
+   for(i=0; i<(int) VarDict.size(); i++) n += 2*VarDict[i].capacity();
+   for(i=0; i<(int) QtyDict.size(); i++) n += 2*QtyDict[i].capacity();
+
+   // Observation indices
+   for(i=0; i<(int) VarObs.size(); i++) {
+      n += (bigint) VarObs[i].capacity()*sizeof(int);
+   }
+   for(map< int, vector<int> >::const_iterator it = CodeObs.begin();
+       it != CodeObs.end(); it++) {
+      n += (bigint) it->second.capacity()*sizeof(int);
+   }
+
+   n += (bigint) SidNObs.capacity()*sizeof(int);
+
+   return(n);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void PointObsTable::get_arrays(int i_obs, float *hdr_arr,
+                               float *obs_arr) const {
+   int i_hdr = ObsHdr[i_obs];
+
+   hdr_arr[0] = HdrLat[i_hdr];
+   hdr_arr[1] = HdrLon[i_hdr];
+   hdr_arr[2] = HdrElv[i_hdr];
+
+   obs_arr[0] = (float) i_hdr;
+   obs_arr[1] = ObsCode[i_obs];
+   obs_arr[2] = ObsLvl[i_obs];
+   obs_arr[3] = ObsHgt[i_obs];
+   obs_arr[4] = ObsVal[i_obs];
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void PointObsTable::select_obs(const char *var_name, int code,
+                               vector<int> &obs_idx) const {
+   const vector<int> *v = (const vector<int> *) 0;
+   const vector<int> *c = (const vector<int> *) 0;
+
+   obs_idx.clear();
+
+   // Observations stored with a matching variable name
+   if(var_name && *var_name) {
+      map<string,int>::const_iterator it = VarIndex.find(var_name);
+      if(it != VarIndex.end()) v = &VarObs[it->second];
+   }
+
+   // Observations stored with a matching GRIB code
+   map< int, vector<int> >::const_iterator it = CodeObs.find(code);
+   if(it != CodeObs.end()) c = &it->second;
+
+   // Merge the sorted lists to preserve the observation order
+   if(v && c) {
+      obs_idx.resize(v->size() + c->size());
+      merge(v->begin(), v->end(), c->begin(), c->end(), obs_idx.begin());
+   }
+   else if(v) obs_idx = *v;
+   else if(c) obs_idx = *c;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,203 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+#ifndef  __POINT_OBS_TABLE_H__
+#define  __POINT_OBS_TABLE_H__
+
+////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "vx_util.h"
+#include "vx_grid.h"
+
+////////////////////////////////////////////////////////////////////////
+
+//
+// Lengths of the header and observation arrays passed to
+// VxPairDataPoint::add_point_obs()
+//
+
+static const int point_obs_hdr_arr_len = 3;   // lat, lon, elv
+static const int point_obs_arr_len     = 5;   // hdr, var, lvl, hgt, val
+
+////////////////////////////////////////////////////////////////////////
+//
+// Point observations decoded once so that they can be matched to any
+// number of verification tasks.  The message type, station ID, variable
+// name, and quality flag strings are stored once and referred to by
+// index, the valid time is stored as a unixtime, and the grid location
+// of each header is computed once.  The observations for each variable
+// name and GRIB code are indexed in the order in which they were added.
+//
+// The table is not indexed by location or valid time.  The verification
+// tasks share a single grid, so the grid location of each header already
+// serves as the spatial lookup, and each task must still visit every
+// observation of its variable to count those rejected by station ID,
+// quality flag, and valid time.
+//
+// The whole observation file is held in memory, about 32 bytes for each
+// observation and 44 bytes for each header plus the distinct strings,
+// as reported by n_bytes().
+//
+////////////////////////////////////////////////////////////////////////
+
+class PointObsTable {
+
+   private:
+
+      void init_from_scratch();
+      void assign(const PointObsTable &);
+
+      int intern(const char *, std::vector<std::string> &,
+                 std::map<std::string,int> &);
+
+      // Header values [n_hdr]
+      std::vector<float>    HdrLat;
+      std::vector<float>    HdrLon;
+      std::vector<float>    HdrElv;
+      std::vector<int>      HdrTyp;     // Index into TypDict
+      std::vector<int>      HdrSid;     // Index into SidDict
+      std::vector<unixtime> HdrUt;
+      std::vector<double>   HdrX;       // Grid x, set by set_grid()
+      std::vector<double>   HdrY;       // Grid y, set by set_grid()
+
+      // Observation values [n_obs]
+      std::vector<int>   ObsHdr;        // Header index
+      std::vector<int>   ObsVar;        // Index into VarDict or -1
+      std::vector<float> ObsCode;       // GRIB code or bad data
+      std::vector<float> ObsLvl;
+      std::vector<float> ObsHgt;
+      std::vector<float> ObsVal;
+      std::vector<int>   ObsQty;        // Index into QtyDict
+
+      // Distinct strings
+      std::vector<std::string> TypDict;
+      std::vector<std::string> SidDict;
+      std::vector<std::string> VarDict;
+      std::vector<std::string> QtyDict;
+
+      std::map<std::string,int> TypIndex;
+      std::map<std::string,int> SidIndex;
+      std::map<std::string,int> VarIndex;
+      std::map<std::string,int> QtyIndex;
+
+      // Observation indices for each variable name and GRIB code
+      std::vector< std::vector<int> > VarObs;
+      std::map< int, std::vector<int> > CodeObs;
+
+      // Number of observations for each station ID
+      std::vector<int> SidNObs;
+
+      int GridNx;
+      int GridNy;
+
+   public:
+
+      PointObsTable();
+     ~PointObsTable();
+      PointObsTable(const PointObsTable &);
+      PointObsTable & operator=(const PointObsTable &);
+
+      void clear();
+
+      //
+      // Set stuff
+      //
+
+      // Returns the header index
+      int  add_hdr(float lat, float lon, float elv, const char *typ,
+                   const char *sid, unixtime ut);
+
+      // The variable name is empty when identified by GRIB code
+      void add_obs(int i_hdr, const char *var_name, float code,
+                   float lvl, float hgt, float val, const char *qty);
+
+      // Compute the grid location of each header
+      void set_grid(const Grid &);
+
+      //
+      // Get stuff
+      //
+
+      int n_hdr() const;
+      int n_obs() const;
+      int n_sid() const;
+      int n_qty() const;
+
+      int grid_nx() const;
+      int grid_ny() const;
+
+      // Approximate memory used by the table
+      bigint n_bytes() const;
+
+      unixtime hdr_ut (int i_hdr) const;
+      double   hdr_x  (int i_hdr) const;
+      double   hdr_y  (int i_hdr) const;
+      int      hdr_sid(int i_hdr) const;
+
+      const char * hdr_typ_str(int i_hdr) const;
+      const char * hdr_sid_str(int i_hdr) const;
+
+      int obs_hdr(int i_obs) const;
+      int obs_qty(int i_obs) const;
+
+      const char * obs_var_str(int i_obs) const;
+      const char * obs_qty_str(int i_obs) const;
+
+      const char * sid_str(int i_sid) const;
+      const char * qty_str(int i_qty) const;
+
+      int sid_n_obs(int i_sid) const;
+
+      // Fill the header and observation arrays for an observation
+      void get_arrays(int i_obs, float *hdr_arr, float *obs_arr) const;
+
+      // Store the indices of the observations identified by the
+      // variable name or GRIB code, in the order they were added
+      void select_obs(const char *var_name, int code,
+                      std::vector<int> &) const;
+
+};
+
+////////////////////////////////////////////////////////////////////////
+
+inline int PointObsTable::n_hdr() const { return((int) HdrUt.size());  }
+inline int PointObsTable::n_obs() const { return((int) ObsHdr.size()); }
+inline int PointObsTable::n_sid() const { return((int) SidDict.size()); }
+inline int PointObsTable::n_qty() const { return((int) QtyDict.size()); }
+
+inline int PointObsTable::grid_nx() const { return(GridNx); }
+inline int PointObsTable::grid_ny() const { return(GridNy); }
+
+inline unixtime PointObsTable::hdr_ut (int i) const { return(HdrUt[i]);  }
+inline double   PointObsTable::hdr_x  (int i) const { return(HdrX[i]);   }
+inline double   PointObsTable::hdr_y  (int i) const { return(HdrY[i]);   }
+inline int      PointObsTable::hdr_sid(int i) const { return(HdrSid[i]); }
+
+inline const char * PointObsTable::hdr_typ_str(int i) const { return(TypDict[HdrTyp[i]].c_str()); }
+inline const char * PointObsTable::hdr_sid_str(int i) const { return(SidDict[HdrSid[i]].c_str()); }
+
+inline int PointObsTable::obs_hdr(int i) const { return(ObsHdr[i]); }
+inline int PointObsTable::obs_qty(int i) const { return(ObsQty[i]); }
+
+inline const char * PointObsTable::obs_var_str(int i) const { return(ObsVar[i] < 0 ? "" : VarDict[ObsVar[i]].c_str()); }
+inline const char * PointObsTable::obs_qty_str(int i) const { return(QtyDict[ObsQty[i]].c_str()); }
+
+inline const char * PointObsTable::sid_str(int i) const { return(SidDict[i].c_str()); }
+inline const char * PointObsTable::qty_str(int i) const { return(QtyDict[i].c_str()); }
+
+inline int PointObsTable::sid_n_obs(int i) const { return(SidNObs[i]); }
+
+////////////////////////////////////////////////////////////////////////
+
+#endif   // __POINT_OBS_TABLE_H__
+
+////////////////////////////////////////////////////////////////////////
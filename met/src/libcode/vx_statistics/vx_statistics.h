@@ -26,6 +26,7 @@
 #include "compute_stats.h"
 #include "pair_base.h"
 #include "pair_data_point.h"
+#include "point_obs_table.h"
 #include "pair_data_ensemble.h"
 #include "read_climo.h"
 #include "obs_error.h"
@@ -98,6 +98,11 @@ static bool get_data_plane        (const char *, GrdFileType, VarInfo *,
                                    DataPlane &, bool do_regrid);
 static bool get_data_plane_array  (const char *, GrdFileType, VarInfo *,
                                    DataPlaneArray &, bool do_regrid);
+static bool get_member_data_plane (int, VarInfo *, DataPlane &);
+static bool get_member_data_plane_array(int, VarInfo *, DataPlaneArray &);
+static string member_cache_key    (int, const VarInfo *);
+static void add_member_cache      (const string &, bool, const DataPlaneArray &);
+static void clear_member_cache    ();
 
 static void process_point_vx      ();
 static void process_point_climo   ();
@@ -166,9 +171,15 @@ int main(int argc, char *argv[]) {
    // Set handler to be called for memory allocation error
    set_new_handler(oom);
 
+   // Enable profiling, if requested
+   mperf.init(program_name);
+
    // Process the command line arguments
    process_command_line(argc, argv);
 
+   // Initialize OpenMP
+   init_openmp();
+
    // Check for valid ensemble data
    process_n_vld();
 
@@ -548,6 +559,7 @@ void process_n_vld() {
    int i, j, n_vld;
    DataPlane dp;
    DataPlaneArray dpa;
+   PerfTimer timer("count_valid");
 
    // Initialize
    n_ens_vld.clear();
@@ -563,8 +575,7 @@ void process_n_vld() {
          if(!ens_file_vld[j]) continue;
 
          // Check for valid data
-         if(!get_data_plane(ens_file_list[j].c_str(), etype,
-                            conf_info.ens_info[i], dp, false)) {
+         if(!get_member_data_plane(j, conf_info.ens_info[i], dp)) {
             mlog << Warning << "\nprocess_n_vld() -> "
                  << "ensemble field \""
                  << conf_info.ens_info[i]->magic_str()
@@ -603,9 +614,13 @@ void process_n_vld() {
 
          // Check for valid data fields.
          // Call data_plane_array to handle multiple levels.
-         if(!get_data_plane_array(ens_file_list[j].c_str(), etype,
-                                  conf_info.vx_opt[i].vx_pd.fcst_info,
-                                  dpa, false)) {
+         // The fields are only regridded here when they are cached
+         // for reuse by the verification steps.
+         if(!(conf_info.member_cache_mb > 0 ?
+              get_member_data_plane_array(j,
+                 conf_info.vx_opt[i].vx_pd.fcst_info, dpa) :
+              get_data_plane_array(ens_file_list[j].c_str(), etype,
+                 conf_info.vx_opt[i].vx_pd.fcst_info, dpa, false))) {
             mlog << Warning << "\nprocess_n_vld() -> "
                  << "no data found for forecast field \""
                  << conf_info.vx_opt[i].vx_pd.fcst_info->magic_str()
@@ -644,47 +659,63 @@ void process_n_vld() {
 bool get_data_plane(const char *infile, GrdFileType ftype,
                     VarInfo *info, DataPlane &dp, bool do_regrid) {
    bool found;
-   Met2dDataFile *mtddf = (Met2dDataFile *) 0;
+   Grid data_grid;
+   PerfTimer timer("read_data");
 
-   // Read the current ensemble file
-   if(!(mtddf = mtddf_factory.new_met_2d_data_file(infile, ftype))) {
-      mlog << Error << "\nget_data_plane() -> "
-           << "trouble reading file \"" << infile << "\"\n\n";
-      exit(1);
-   }
+   // The data file libraries are not thread safe, so only one
+   // thread reads at a time.  Regridding runs concurrently.
+#pragma omp critical(met_read_data)
+   {
+      Met2dDataFile *mtddf = (Met2dDataFile *) 0;
 
-   // Read the gridded data field
-   if((found = mtddf->data_plane(*info, dp))) {
+      // Read the current ensemble file
+      if(!(mtddf = mtddf_factory.new_met_2d_data_file(infile, ftype))) {
+         mlog << Error << "\nget_data_plane() -> "
+              << "trouble reading file \"" << infile << "\"\n\n";
+         exit(1);
+      }
 
-      // Setup the verification grid, if necessary
-      if(nxy == 0) process_grid(mtddf->grid());
+      // Read the gridded data field
+      if((found = mtddf->data_plane(*info, dp))) {
+
+         data_grid = mtddf->grid();
+
+         // Setup the verification grid, if necessary
+         if(nxy == 0) process_grid(data_grid);
+      }
+
+      // Deallocate the data file pointer, if necessary
+      if(mtddf) { delete mtddf; mtddf = (Met2dDataFile *) 0; }
+   }
+
+   if(found) {
 
       // Regrid, if requested and necessary
-      if(do_regrid && !(mtddf->grid() == grid)) {
+      if(do_regrid && !(data_grid == grid)) {
          mlog << Debug(1)
               << "Regridding field \"" << info->magic_str()
               << "\" to the verification grid.\n";
-         dp = met_regrid(dp, mtddf->grid(), grid, info->regrid());
+         dp = met_regrid(dp, data_grid, grid, info->regrid());
       }
 
-      // Store the valid time, if not already set
-      if(ens_valid_ut == (unixtime) 0) {
-         ens_valid_ut = dp.valid();
-      }
-      // Check to make sure that the valid time doesn't change
-      else if(ens_valid_ut != dp.valid()) {
-         mlog << Warning << "\nget_data_plane() -> "
-              << "The valid time has changed, "
-              << unix_to_yyyymmdd_hhmmss(ens_valid_ut)
-              << " != " << unix_to_yyyymmdd_hhmmss(dp.valid())
-              << " in \"" << infile << "\"\n\n";
+#pragma omp critical(met_read_data)
+      {
+         // Store the valid time, if not already set
+         if(ens_valid_ut == (unixtime) 0) {
+            ens_valid_ut = dp.valid();
+         }
+         // Check to make sure that the valid time doesn't change
+         else if(ens_valid_ut != dp.valid()) {
+            mlog << Warning << "\nget_data_plane() -> "
+                 << "The valid time has changed, "
+                 << unix_to_yyyymmdd_hhmmss(ens_valid_ut)
+                 << " != " << unix_to_yyyymmdd_hhmmss(dp.valid())
+                 << " in \"" << infile << "\"\n\n";
+         }
       }
 
    } // end if found
 
-   // Deallocate the data file pointer, if necessary
-   if(mtddf) { delete mtddf; mtddf = (Met2dDataFile *) 0; }
-
    return(found);
 }
 
@@ -696,6 +727,7 @@ bool get_data_plane_array(const char *infile, GrdFileType ftype,
    int n, i;
    bool found;
    Met2dDataFile *mtddf = (Met2dDataFile *) 0;
+   PerfTimer timer("read_data");
 
    // Read the current ensemble file
    if(!(mtddf = mtddf_factory.new_met_2d_data_file(infile, ftype))) {
@@ -750,11 +782,169 @@ bool get_data_plane_array(const char *infile, GrdFileType ftype,
 
 ////////////////////////////////////////////////////////////////////////
 
+bool get_member_data_plane(int i_ens, VarInfo *info, DataPlane &dp) {
+   bool found, is_cached;
+   DataPlaneArray dpa;
+   string key = member_cache_key(i_ens, info);
+
+   // Use the cached field, if present.  Members may be read
+   // concurrently, so the cache is accessed by one thread at a time.
+   // Fields cached as an array are used when they have one level.
+#pragma omp critical(met_member_cache)
+   {
+      map<string,MemberCacheEntry>::const_iterator it = member_cache.find(key);
+      if((is_cached = (it != member_cache.end()))) {
+         found = it->second.found;
+         if(found) {
+            if(it->second.dpa.n_planes() == 1) dp = it->second.dpa[0];
+            else                               is_cached = false;
+         }
+      }
+   }
+
+   if(is_cached) {
+      mlog << Debug(4) << "Using cached field \"" << info->magic_str()
+           << "\" from file \"" << ens_file_list[i_ens] << "\".\n";
+      return(found);
+   }
+
+   // Read and regrid the field
+   found = get_data_plane(ens_file_list[i_ens].c_str(), etype,
+                          info, dp, true);
+
+   if(found) dpa.add(dp, bad_data_double, bad_data_double);
+
+#pragma omp critical(met_member_cache)
+   add_member_cache(key, found, dpa);
+
+   return(found);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool get_member_data_plane_array(int i_ens, VarInfo *info,
+                                 DataPlaneArray &dpa) {
+   bool found;
+   string key = member_cache_key(i_ens, info);
+   map<string,MemberCacheEntry>::const_iterator it;
+
+   // Use the cached fields, if present
+   if((it = member_cache.find(key)) != member_cache.end()) {
+      mlog << Debug(4) << "Using cached field \"" << info->magic_str()
+           << "\" from file \"" << ens_file_list[i_ens] << "\".\n";
+      if(it->second.found) dpa = it->second.dpa;
+      return(it->second.found);
+   }
+
+   // Read and regrid the fields
+   found = get_data_plane_array(ens_file_list[i_ens].c_str(), etype,
+                                info, dpa, true);
+
+   add_member_cache(key, found, dpa);
+
+   return(found);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Fields are cached by what they are rather than by the VarInfo object
+// used to request them: the member index, file name, and magic string,
+// along with the censoring options and whether a conversion function
+// is applied as the data is read.  A single level is cached under the same key whether it is
+// read as a field or as an array of levels.
+//
+////////////////////////////////////////////////////////////////////////
+
+string member_cache_key(int i_ens, const VarInfo *info) {
+   ConcatString cs;
+   int i;
+
+   cs << i_ens << " " << ens_file_list[i_ens] << " "
+      << info->magic_str() << " "
+      << info->censor_thresh().get_str() << " ";
+
+   for(i=0; i<info->censor_val().n(); i++) {
+      cs << info->censor_val()[i] << " ";
+   }
+
+   cs << (info->ConvertFx.is_set() ? "convert" : "");
+
+   return(string(cs.c_str()));
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void add_member_cache(const string &key, bool found,
+                      const DataPlaneArray &dpa) {
+   int i;
+   long long max_bytes = (long long) conf_info.member_cache_mb*1024*1024;
+   long long n_bytes = 0;
+
+   // Check if the cache is disabled or already has these fields
+   if(max_bytes == 0 || member_cache.count(key) > 0) return;
+
+   // Fields stored in mapped files are not counted
+   if(found && conf_info.member_storage != DataPlaneStorage_Mapped) {
+      n_bytes = (long long) dpa.n_planes() * dpa.nx() * dpa.ny() *
+                (conf_info.member_storage == DataPlaneStorage_Float ?
+                 sizeof(float) : sizeof(double));
+   }
+
+   // Skip fields that will not fit
+   if(n_bytes > max_bytes) return;
+
+   // Drop the oldest fields to make room
+   while(member_cache_bytes + n_bytes > max_bytes &&
+         !member_cache_order.empty()) {
+      map<string,MemberCacheEntry>::iterator it =
+         member_cache.find(member_cache_order.front());
+      member_cache_bytes -= it->second.n_bytes;
+      member_cache.erase(it);
+      member_cache_order.pop_front();
+   }
+
+   // Store the fields
+   MemberCacheEntry &e = member_cache[key];
+   e.found   = found;
+   e.n_bytes = n_bytes;
+   if(found) {
+      e.dpa = dpa;
+      for(i=0; i<e.dpa.n_planes(); i++) {
+         e.dpa[i].set_storage(conf_info.member_storage,
+                              conf_info.tmp_dir.c_str());
+      }
+   }
+
+   member_cache_order.push_back(key);
+   member_cache_bytes += n_bytes;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void clear_member_cache() {
+
+   member_cache.clear();
+   member_cache_order.clear();
+   member_cache_bytes = 0;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
 void process_ensemble() {
-   int i, j;
+   int i, j, k, j_end, i_last;
    bool reset;
    DataPlane ens_dp;
    unixtime max_init_ut = bad_data_ll;
+   PerfTimer timer("ensemble_products");
+
+   // Read up to one member per thread at a time
+   const int n_batch = max(1, min(met_num_threads(), ens_file_list.n()));
+   DataPlane *batch_dp = new DataPlane [n_batch];
+   vector<char> batch_found(n_batch);
 
    // Loop through each of the ensemble fields to be processed
    for(i=0; i<conf_info.get_n_ens_var(); i++) {
@@ -763,35 +953,53 @@ void process_ensemble() {
            << "Processing ensemble field: "
            << conf_info.ens_info[i]->magic_str() << "\n";
 
-      // Loop through each of the input forecast files
-      for(j=0, reset=true; j<ens_file_list.n(); j++) {
+      // Loop through each batch of input forecast files
+      for(j=0, reset=true; j<ens_file_list.n(); j=j_end) {
 
-         // Skip bad data files
-         if(!ens_file_vld[j]) continue;
+         j_end  = min(j + n_batch, ens_file_list.n());
+         i_last = -1;
 
-         // Read the current field
-         if(!get_data_plane(ens_file_list[j].c_str(), etype,
-                            conf_info.ens_info[i], ens_dp, true)) continue;
+         // Read and regrid the members of the batch concurrently
+#pragma omp parallel for schedule(dynamic)
+         for(k=j; k<j_end; k++) {
 
-         // Create a NetCDF file to store the ensemble output
-         if(nc_out == (NcFile *) 0) {
-            setup_nc_file(ens_dp.valid(), "_ens.nc");
+            // Skip bad data files
+            batch_found[k-j] = (ens_file_vld[k] &&
+                                get_member_data_plane(k, conf_info.ens_info[i],
+                                                      batch_dp[k-j]));
          }
 
-         // Reset the running sums and counts
-         if(reset) {
-            clear_counts();
-            reset = false;
-         }
+         // Apply the members in order so that the sums do not
+         // depend on the number of threads
+         for(k=j; k<j_end; k++) {
 
-         // Apply current data to the running sums and counts
-         track_counts(i, ens_dp);
+            if(!batch_found[k-j]) continue;
+
+            // Create a NetCDF file to store the ensemble output
+            if(nc_out == (NcFile *) 0) {
+               setup_nc_file(batch_dp[k-j].valid(), "_ens.nc");
+            }
+
+            // Reset the running sums and counts
+            if(reset) {
+               clear_counts();
+               reset = false;
+            }
+
+            // Apply current data to the running sums and counts
+            track_counts(i, batch_dp[k-j]);
+
+            // Keep track of the maximum initialization time
+            if(is_bad_data(max_init_ut) || batch_dp[k-j].init() > max_init_ut) {
+               max_init_ut = batch_dp[k-j].init();
+            }
 
-         // Keep track of the maximum initialization time
-         if(is_bad_data(max_init_ut) || ens_dp.init() > max_init_ut) {
-            max_init_ut = ens_dp.init();
+            i_last = k - j;
          }
 
+         // Keep the last member read
+         if(i_last >= 0) ens_dp = batch_dp[i_last];
+
       } // end for j
 
       // Write out the ensemble information to a NetCDF file
@@ -810,6 +1018,8 @@ void process_ensemble() {
       nc_out = (NcFile *) 0;
    }
 
+   if(batch_dp) { delete [] batch_dp; batch_dp = (DataPlane *) 0; }
+
    return;
 }
 
@@ -849,6 +1059,7 @@ void process_vx() {
 void process_point_vx() {
    int i, n_miss;
    unixtime beg_ut, end_ut;
+   PerfTimer timer("point_vx");
 
    // Set observation time window for each verification task
    for(i=0; i<conf_info.get_n_vx(); i++) {
@@ -1051,6 +1262,17 @@ void process_point_obs(int i_nc) {
       }
    }
 
+   // Decoded observations for the current block, shared read-only
+   // by the verification tasks.  These are allocated on the heap
+   // since a block may hold many observations.
+   vector<float>    blk_hdr_arr(buf_size*hdr_arr_len);
+   vector<int>      blk_hdr_typ_arr(buf_size*hdr_typ_arr_len);
+   vector<float>    blk_obs_arr(buf_size*OBS_ARRAY_LEN);
+   vector<unixtime> blk_hdr_ut(buf_size);
+   vector<char>   blk_ok(buf_size);
+   vector<string> blk_typ_str(buf_size), blk_sid_str(buf_size);
+   vector<string> blk_qty_str(buf_size), blk_var_name(buf_size);
+
    for(int i_start=0; i_start<obs_count; i_start+=buf_size) {
       buf_size = ((obs_count-i_start) > DEF_NC_BUFFER_SIZE) ? DEF_NC_BUFFER_SIZE : (obs_count-i_start);
 
@@ -1084,6 +1306,7 @@ void process_point_obs(int i_nc) {
                  << " from observation number " << i_obs
                  << " of point observation file: "
                  << point_obs_file_list[i_nc] << "\n\n";
+            blk_ok[i_offset] = false;
             continue;
          }
 
@@ -1122,16 +1345,45 @@ void process_point_obs(int i_nc) {
             var_name = "";
          }
 
-         // Check each conf_info.vx_pd object to see if this observation
-         // should be added
-         for(j=0; j<conf_info.get_n_vx(); j++) {
+         // Store the decoded observation for this block
+         blk_ok[i_offset] = true;
+         for (j=0; j<hdr_arr_len; j++) blk_hdr_arr[i_offset*hdr_arr_len + j] = hdr_arr[j];
+         for (j=0; j<hdr_typ_arr_len; j++) blk_hdr_typ_arr[i_offset*hdr_typ_arr_len + j] = hdr_typ_arr[j];
+         for (j=0; j<OBS_ARRAY_LEN; j++) blk_obs_arr[i_offset*OBS_ARRAY_LEN + j] = obs_arr[j];
+         blk_hdr_ut[i_offset]   = hdr_ut;
+         blk_typ_str[i_offset]  = hdr_typ_str;
+         blk_sid_str[i_offset]  = hdr_sid_str;
+         blk_qty_str[i_offset]  = obs_qty_str;
+         blk_var_name[i_offset] = var_name;
+      }
+
+      // Check each conf_info.vx_pd object to see if these observations
+      // should be added.  The tasks share the decoded block and each
+      // one adds its observations in file order, so they run
+      // concurrently.
+#pragma omp parallel for schedule(dynamic)
+      for(j=0; j<conf_info.get_n_vx(); j++) {
+         float task_hdr_arr[hdr_arr_len], task_obs_arr[OBS_ARRAY_LEN];
+         int   task_hdr_typ_arr[hdr_typ_arr_len];
+         int   k;
+
+         for(int i_offset=0; i_offset<buf_size; i_offset++) {
+
+            if(!blk_ok[i_offset]) continue;
+
+            for (k=0; k<hdr_arr_len; k++) task_hdr_arr[k] = blk_hdr_arr[i_offset*hdr_arr_len + k];
+            for (k=0; k<hdr_typ_arr_len; k++) task_hdr_typ_arr[k] = blk_hdr_typ_arr[i_offset*hdr_typ_arr_len + k];
+            for (k=0; k<OBS_ARRAY_LEN; k++) task_obs_arr[k] = blk_obs_arr[i_offset*OBS_ARRAY_LEN + k];
 
             // Attempt to add the observation to the vx_pd object
-            conf_info.vx_opt[j].vx_pd.add_point_obs(hdr_arr,
-                                         hdr_typ_arr, hdr_typ_str.c_str(),
-                                         hdr_sid_str.c_str(), hdr_ut,
-                                         obs_qty_str.c_str(), obs_arr,
-                                         grid, var_name.c_str());
+            conf_info.vx_opt[j].vx_pd.add_point_obs(task_hdr_arr,
+                                         task_hdr_typ_arr,
+                                         blk_typ_str[i_offset].c_str(),
+                                         blk_sid_str[i_offset].c_str(),
+                                         blk_hdr_ut[i_offset],
+                                         blk_qty_str[i_offset].c_str(),
+                                         task_obs_arr, grid,
+                                         blk_var_name[i_offset].c_str());
          }
       }
    } // end for i_start
@@ -1184,8 +1436,10 @@ int process_point_ens(int i_ens, int &n_miss) {
       }
 
       // Read the gridded data from the input forecast file
-      if(!get_data_plane_array(ens_file.c_str(), info->file_type(), info,
-                               fcst_dpa, true)) {
+      if(!(is_ens_mean ?
+           get_data_plane_array(ens_file.c_str(), info->file_type(), info,
+                                fcst_dpa, true) :
+           get_member_data_plane_array(i_ens, info, fcst_dpa))) {
 
          // Error out if unable to read the ensemble mean
          if(is_ens_mean) {
@@ -1440,6 +1694,7 @@ void process_grid_vx() {
    DataPlane emn_dp, cmn_dp, csd_dp;
    PairDataEnsemble pd_all, pd;
    ObsErrorEntry *oerr_ptr = (ObsErrorEntry *) 0;
+   PerfTimer timer("grid_vx");
 
    mlog << Debug(2) << "\n" << sep_str << "\n\n";
 
@@ -1450,6 +1705,24 @@ void process_grid_vx() {
    fcst_dp = new DataPlane [n_ens];
    fraw_dp = new DataPlane [n_ens];
 
+   // Optionally store the member fields in single precision
+   if(conf_info.member_storage != DataPlaneStorage_Double) {
+      mlog << Debug(3)
+           << "Storing the " << n_ens << " ensemble member fields in "
+           << "single precision"
+           << (conf_info.member_storage == DataPlaneStorage_Mapped ?
+               " memory-mapped scratch files in " : "")
+           << (conf_info.member_storage == DataPlaneStorage_Mapped ?
+               conf_info.tmp_dir.c_str() : "")
+           << ".\n";
+      for(j=0; j<n_ens; j++) {
+         fcst_dp[j].set_storage(conf_info.member_storage,
+                                conf_info.tmp_dir.c_str());
+         fraw_dp[j].set_storage(conf_info.member_storage,
+                                conf_info.tmp_dir.c_str());
+      }
+   }
+
    // Loop through each of the fields to be verified
    for(i=0; i<conf_info.get_n_vx(); i++) {
 
@@ -1532,9 +1805,9 @@ void process_grid_vx() {
 
          // If the current ensemble file is valid, read the field
          if(ens_file_vld[j]) {
-            found = get_data_plane(ens_file_list[j].c_str(), etype,
-                                   conf_info.vx_opt[i].vx_pd.fcst_info,
-                                   fcst_dp[j], true);
+            found = get_member_data_plane(j,
+                                          conf_info.vx_opt[i].vx_pd.fcst_info,
+                                          fcst_dp[j]);
          }
          else {
             found = false;
@@ -1896,6 +2169,7 @@ void process_grid_scores(int i_vx,
    int i, j, x, y, n_miss;
    double cmn, csd;
    ObsErrorEntry *e = (ObsErrorEntry *) 0;
+   PerfTimer timer("grid_pairs");
 
    // Allocate memory in one big chunk based on grid size
    pd.extend(grid.nx()*grid.ny());
@@ -2104,11 +2378,13 @@ void track_counts(int i_vx, const DataPlane &dp) {
    const int Nthresh = conf_info.ens_ta[i_vx].n();
    SingleThresh *ThreshBuf = conf_info.ens_ta[i_vx].buf();
 
-   // Increment counts for each grid point
+   // Increment counts for each grid point.  Each point is updated by
+   // only one thread, so the results do not depend on the thread count.
+#pragma omp parallel for private(j, v)
    for(i=0; i<nxy; i++) {
 
       // Get current value
-      v = *Data++;
+      v = Data[i];
 
       // Skip the bad data value
       if(is_bad_data(v)) continue;
@@ -2134,18 +2410,22 @@ void track_counts(int i_vx, const DataPlane &dp) {
    // Increment NMEP count anywhere fractional coverage > 0
    if(conf_info.nc_info.do_nmep) {
       DataPlane frac_dp;
+      NbrhdCountTable nct;
 
       // Loop over thresholds
       for(i=0; i<Nthresh; i++) {
 
+         // Build the count tables once for all neighborhood sizes
+         nct.set(dp, ThreshBuf[i]);
+
          // Loop over neighborhood sizes
          for(j=0; j<conf_info.get_n_nbrhd(); j++) {
 
             // Compute fractional coverage
-            fractional_coverage(dp, frac_dp,
+            fractional_coverage(nct, frac_dp,
                conf_info.nbrhd_prob.width[j],
                conf_info.nbrhd_prob.shape,
-               ThreshBuf[i], conf_info.nbrhd_prob.vld_thresh);
+               conf_info.nbrhd_prob.vld_thresh);
 
             // Increment counts
             const double *Frac = frac_dp.data();
@@ -3038,7 +3318,9 @@ void clean_up() {
    mlog << Debug(2) << "\n" << sep_str << "\n\n";
 
    // Close the output text files that were open for writing
+   PerfTimer output_timer("write_output");
    if(vx_flag) finish_txt_files();
+   output_timer.stop();
 
    // List the output NetCDF files
    for(i=0; i<out_nc_file_list.n(); i++) {
@@ -3046,6 +3328,9 @@ void clean_up() {
            << "Output file: " << out_nc_file_list[i] << "\n";
    }
 
+   // Release the cached member fields
+   clear_member_cache();
+
    // Deallocate threshold count arrays
    if(thresh_count_na) {
       for(i=0; i<conf_info.get_max_n_thresh(); i++) {
@@ -34,6 +34,8 @@ using namespace std;
 #include <dirent.h>
 #include <iostream>
 #include <fstream>
+#include <list>
+#include <map>
 #include <math.h>
 #include <string.h>
 #include <sys/stat.h>
@@ -184,6 +186,17 @@ static DataPlane wgt_dp;
 // Data file factory and input files
 static Met2dDataFileFactory mtddf_factory;
 
+// Ensemble member fields already read and regridded, keyed by member,
+// field, and read type, and the order in which they were added
+struct MemberCacheEntry {
+   bool           found;
+   DataPlaneArray dpa;
+   long long      n_bytes;
+};
+static map<string,MemberCacheEntry> member_cache;
+static list<string> member_cache_order;
+static long long    member_cache_bytes = 0;
+
 // Strings to be output in the STAT and optional text files
 static StatHdrColumns shc;
 
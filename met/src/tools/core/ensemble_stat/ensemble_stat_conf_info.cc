@@ -78,6 +78,8 @@ void EnsembleStatConfInfo::clear() {
    mask_area_map.clear();
    mask_sid_map.clear();
    grid_weight_flag = GridWeightType_None;
+   member_storage = DataPlaneStorage_Double;
+   member_cache_mb = 0;
    tmp_dir.clear();
    output_prefix.clear();
    version.clear();
@@ -137,6 +139,7 @@ void EnsembleStatConfInfo::process_config(GrdFileType etype,
    Dictionary *edict  = (Dictionary *) 0;
    Dictionary *fdict = (Dictionary *) 0;
    Dictionary *odict  = (Dictionary *) 0;
+   Dictionary *sdict  = (Dictionary *) 0;
    Dictionary i_edict, i_fdict, i_odict;
    InterpMthd mthd;
 
@@ -166,6 +169,23 @@ void EnsembleStatConfInfo::process_config(GrdFileType etype,
    // Conf: grid_weight_flag
    grid_weight_flag = parse_conf_grid_weight_flag(&conf);
 
+   // Conf: member_storage
+   sdict = conf.lookup_dictionary(conf_key_member_storage);
+   if(!sdict->lookup_bool(conf_key_float32))     member_storage = DataPlaneStorage_Double;
+   else if(!sdict->lookup_bool(conf_key_mapped)) member_storage = DataPlaneStorage_Float;
+   else                                          member_storage = DataPlaneStorage_Mapped;
+   member_cache_mb = sdict->lookup_int(conf_key_cache_mb);
+   if(member_cache_mb < 0) {
+      mlog << Error << "\nEnsembleStatConfInfo::process_config() -> "
+           << "the \"" << conf_key_member_storage << "." << conf_key_cache_mb
+           << "\" entry (" << member_cache_mb
+           << ") must be non-negative.\n\n";
+      exit(1);
+   }
+
+   // Conf: tmp_dir
+   tmp_dir = parse_conf_tmp_dir(&conf);
+
    // Conf: output_prefix
    output_prefix = conf.lookup_string(conf_key_output_prefix);
 
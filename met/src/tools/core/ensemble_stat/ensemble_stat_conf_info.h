@@ -221,6 +221,8 @@ class EnsembleStatConfInfo {
       gsl_rng *rng_ptr;                     // GSL random number generator (allocated)
 
       GridWeightType grid_weight_flag;      // Grid weighting flag
+      DataPlaneStorage member_storage;      // Storage for the ensemble member fields
+      int              member_cache_mb;     // Size of the member field cache
       ConcatString   tmp_dir;               // Directory for temporary files
       ConcatString   output_prefix;         // String to customize output file name
       ConcatString   version;               // Config file version
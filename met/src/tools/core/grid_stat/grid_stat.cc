@@ -187,9 +187,15 @@ int main(int argc, char *argv[]) {
    // Set handler to be called for memory allocation error
    set_new_handler(oom);
 
+   // Enable profiling, if requested
+   mperf.init(program_name);
+
    // Process the command line arguments
    process_command_line(argc, argv);
 
+   // Initialize OpenMP
+   init_openmp();
+
    // Compute the scores and write them out
    process_scores();
 
@@ -700,12 +706,14 @@ void process_scores() {
       }
 
       // Read climatology data
+      PerfTimer climo_timer("read_climo");
       cmn_dp = read_climo_data_plane(
                   conf_info.conf.lookup_array(conf_key_climo_mean_field, false),
                   i, fcst_dp.valid(), grid);
       csd_dp = read_climo_data_plane(
                   conf_info.conf.lookup_array(conf_key_climo_stdev_field, false),
                   i, fcst_dp.valid(), grid);
+      climo_timer.stop();
 
       mlog << Debug(3)
            << "Found " << (cmn_dp.nx() == 0 ? 0 : 1)
@@ -750,6 +758,7 @@ void process_scores() {
       InterpInfo * interp = &conf_info.vx_opt[i].interp_info;
 
       // Loop through and apply each of the smoothing operations
+      PerfTimer interp_timer("interp_stats");
       for(j=0; j<conf_info.vx_opt[i].get_n_interp(); j++) {
 
          // Current interpolation method
@@ -1321,8 +1330,11 @@ void process_scores() {
 
       } // end for j (n_interp)
 
+      interp_timer.stop();
+
       // Loop through and apply the Neighborhood methods for each of the
       // neighborhood widths if requested in the config file
+      PerfTimer nbrhd_timer("nbrhd_stats");
       if(!conf_info.vx_opt[i].fcst_info->is_prob() &&
          (conf_info.vx_opt[i].output_flag[i_nbrctc] != STATOutputType_None ||
           conf_info.vx_opt[i].output_flag[i_nbrcts] != STATOutputType_None ||
@@ -1569,7 +1581,10 @@ void process_scores() {
          } // end for j
       } // end if
 
+      nbrhd_timer.stop();
+
       // Loop through and apply each Fourier wave
+      PerfTimer fourier_timer("fourier_stats");
       for(j=0; j<conf_info.vx_opt[i].get_n_wave_1d(); j++) {
 
          // Apply Fourier decomposition
@@ -2909,6 +2924,8 @@ void finish_txt_files() {
 
 void clean_up() {
 
+   PerfTimer output_timer("write_output");
+
    // Close the output text files that were open for writing
    finish_txt_files();
 
@@ -2923,6 +2940,8 @@ void clean_up() {
       nc_out = (NcFile *) 0;
    }
 
+   output_timer.stop();
+
    // Deallocate memory for data files
    if(fcst_mtddf) { delete fcst_mtddf; fcst_mtddf = (Met2dDataFile *) 0; }
    if(obs_mtddf)  { delete obs_mtddf;  obs_mtddf  = (Met2dDataFile *) 0; }
@@ -2990,7 +3009,9 @@ void set_compress(const StringArray & a) {
 bool read_data_plane(VarInfo* info, DataPlane& dp, Met2dDataFile* mtddf,
                      const ConcatString &filename) {
 
+   PerfTimer read_timer("read_data");
    bool status = mtddf->data_plane(*info, dp);
+   read_timer.stop();
 
    if(!status) {
       mlog << Warning << "\nread_data_plane() -> "
@@ -3006,6 +3027,7 @@ bool read_data_plane(VarInfo* info, DataPlane& dp, Met2dDataFile* mtddf,
            << "Regridding field "
            << info->magic_str()
            << " to the verification grid.\n";
+      PerfTimer regrid_timer("regrid");
       dp = met_regrid(dp, mtddf->grid(), grid, info->regrid());
    }
 
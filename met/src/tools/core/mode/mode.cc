@@ -132,12 +132,24 @@ int main(int argc, char * argv [])
 
 set_new_handler(oom);
 
+   //
+   // Enable profiling, if requested
+   //
+
+mperf.init(program_name);
+
    //
    // Process the command line arguments
    //
 
 process_command_line(argc, argv);
 
+   //
+   // Initialize OpenMP
+   //
+
+init_openmp();
+
    //
    // Process the forecast and observation files
    //
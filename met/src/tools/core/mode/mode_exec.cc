@@ -124,6 +124,9 @@ out_dir.clear();
 
 data_min = data_max = 0.0;
 
+Fcst_conv_sd.clear();
+ Obs_conv_sd.clear();
+
 R_index = T_index = 0;
 
 
@@ -217,6 +220,7 @@ void ModeExecutive::setup_fcst_obs_data()
 
    // ShapeData fcst_sd, obs_sd;
    double fmin, omin, fmax, omax;
+   PerfTimer timer("read_data");
 
    Fcst_sd.clear();
     Obs_sd.clear();
@@ -366,8 +370,6 @@ void ModeExecutive::do_conv_thresh(const int r_index, const int t_index)
 
 ModeConfInfo & conf = engine.conf_info;
 
-static int local_r_index = -1;
-
 R_index = r_index;
 T_index = t_index;
 
@@ -384,15 +386,27 @@ if ( conf.need_obs_merge_thresh  () )  conf.set_obs_merge_thresh_by_index  (T_in
 mlog << Debug(2)
      << "Identifying objects in the forecast and observation fields...\n";
 
-if ( r_index != local_r_index )  {   //  need to do convolution
+PerfTimer conv_timer("conv_thresh");
+
+   //
+   //  Reuse the convolved fields for these radii, if available.
+   //  The valid data threshold doesn't change between runs.
+   //
 
-   engine.set(Fcst_sd, Obs_sd);
+map<int, ShapeData>::const_iterator f_it = Fcst_conv_sd.find(conf.fcst_conv_radius);
+map<int, ShapeData>::const_iterator o_it =  Obs_conv_sd.find(conf.obs_conv_radius);
 
-} else {   //  don't need to do convolution
+const bool fcst_cached = ( f_it != Fcst_conv_sd.end() );
+const bool  obs_cached = ( o_it !=  Obs_conv_sd.end() );
 
-   engine.set_no_conv(Fcst_sd, Obs_sd);
+engine.set_with_conv(Fcst_sd, Obs_sd,
+                     ( fcst_cached ? &(f_it->second) : (const ShapeData *) 0 ),
+                     (  obs_cached ? &(o_it->second) : (const ShapeData *) 0 ));
 
-}
+if ( !fcst_cached )  Fcst_conv_sd[conf.fcst_conv_radius] = *(engine.fcst_conv);
+if ( ! obs_cached )   Obs_conv_sd[conf.obs_conv_radius]  = *(engine.obs_conv);
+
+conv_timer.stop();
 
    //
    //  Compute the contingency table statistics for the fields, if needed
@@ -405,8 +419,6 @@ if ( conf.ct_stats_flag )  compute_ct_stats();
    //  done
    //
 
-local_r_index = r_index;
-
 return;
 
 }
@@ -430,6 +442,8 @@ void ModeExecutive::do_match_merge()
 
    // Do the forecast merging
 
+   PerfTimer merge_timer("merge");
+
    engine.do_fcst_merging(default_config_file.c_str(), merge_config_file.c_str());
 
    mlog << Debug(2)
@@ -441,6 +455,8 @@ void ModeExecutive::do_match_merge()
 
    engine.do_obs_merging(default_config_file.c_str(), merge_config_file.c_str());
 
+   merge_timer.stop();
+
    mlog << Debug(2)
         << "Remaining: " << engine.n_fcst << " forecast objects "
         << "and " << engine.n_obs << " observation objects.\n";
@@ -452,6 +468,8 @@ void ModeExecutive::do_match_merge()
 
    // Do the matching of objects between fields
 
+   PerfTimer match_timer("match");
+
    engine.do_matching();
 
 return;
@@ -523,6 +541,8 @@ void ModeExecutive::process_output()
 
    // Create output stats files and plots
 
+PerfTimer timer("write_output");
+
 write_obj_stats();
 
 if ( engine.conf_info.ct_stats_flag )  write_ct_stats();
@@ -543,6 +563,7 @@ void ModeExecutive::compute_ct_stats()
 
    int i, x, y;
    ShapeData fcst_mask, obs_mask;
+   PerfTimer timer("ct_stats");
 
    mlog << Debug(2)
         << "Computing contingency table statistics...\n";
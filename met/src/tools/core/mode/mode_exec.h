@@ -21,6 +21,7 @@
 
 
 #include <iostream>
+#include <map>
 
 #include <netcdf>
 using namespace netCDF;
@@ -117,6 +118,14 @@ class ModeExecutive {
 
       ShapeData Fcst_sd, Obs_sd;
 
+         //
+         // Convolved fields for each convolution radius, so that each
+         // radius is applied only once for all of the thresholds
+         //
+
+      std::map<int, ShapeData> Fcst_conv_sd;
+      std::map<int, ShapeData>  Obs_conv_sd;
+
       void setup_fcst_obs_data();
       void do_conv_thresh(const int r_index, const int t_index);
       void do_match_merge();
@@ -105,6 +105,7 @@ using namespace std;
 #include <ctype.h>
 #include <dirent.h>
 #include <iostream>
+#include <map>
 #include <fstream>
 #include <math.h>
 #include <string.h>
@@ -166,9 +167,15 @@ int main(int argc, char *argv[]) {
    // Set handler to be called for memory allocation error
    set_new_handler(oom);
 
+   // Enable profiling, if requested
+   mperf.init(program_name);
+
    // Process the command line arguments
    process_command_line(argc, argv);
 
+   // Initialize OpenMP
+   init_openmp();
+
    // Process the forecast and climo files
    process_fcst_climo_files();
 
@@ -178,10 +185,12 @@ int main(int argc, char *argv[]) {
    }
 
    // Calculate and print observation summaries
+   PerfTimer summary_timer("obs_summary");
    for(i=0; i<conf_info.get_n_vx(); i++) {
       conf_info.vx_opt[i].vx_pd.calc_obs_summary();
       conf_info.vx_opt[i].vx_pd.print_obs_summary();
    }
+   summary_timer.stop();
 
    // Compute the scores and write them out
    process_scores();
@@ -533,6 +542,7 @@ void process_fcst_climo_files() {
    int n_fcst;
    DataPlaneArray fcst_dpa, cmn_dpa, csd_dpa;
    unixtime file_ut, beg_ut, end_ut;
+   PerfTimer timer("read_fcst_climo");
 
    // Loop through each of the fields to be verified and extract
    // the forecast and climatological fields for verification
@@ -642,7 +652,7 @@ void process_fcst_climo_files() {
 
 void process_obs_file(int i_nc) {
    int j, i_obs;
-   float obs_arr[OBS_ARRAY_LEN], hdr_arr[hdr_arr_len];
+   float obs_arr[OBS_ARRAY_LEN];
    float prev_obs_arr[OBS_ARRAY_LEN];
    char hdr_typ_str[max_str_len];
    char hdr_sid_str[max_str_len];
@@ -650,6 +660,9 @@ void process_obs_file(int i_nc) {
    char obs_qty_str[max_str_len];
    unixtime hdr_ut;
    NcFile *obs_in = (NcFile *) 0;
+   PointObsTable obs_tbl;
+
+   PerfTimer timer("process_obs");
 
    // Set flags for vectors
    bool vflag = conf_info.get_vflag();
@@ -723,6 +736,8 @@ void process_obs_file(int i_nc) {
         << " observations from " << hdr_count
         << " messages.\n";
 
+   mperf.add_count("obs_searched", obs_count);
+
    StringArray var_names;
    ConcatString var_name("");
    if (use_var_id) {
@@ -758,8 +773,51 @@ void process_obs_file(int i_nc) {
       }
    }
 
+   // Store each header once, converting each distinct valid time
+   // string to a unixtime only once
+   int hdr_idx, str_length, block_size;
+   map<int,unixtime> vld_ut_map;
+   map<int,unixtime>::const_iterator vld_it;
+
+   for(int i_hdr=0; i_hdr<hdr_count; i_hdr++) {
+
+      // Read the header type for this header
+      hdr_idx = use_arr_vars ? i_hdr : header_data.typ_idx_array[i_hdr];
+      str_length = header_data.typ_array[hdr_idx].length();
+      if (str_length > typ_len) str_length = typ_len;
+      strncpy(hdr_typ_str, header_data.typ_array[hdr_idx].c_str(), str_length);
+      hdr_typ_str[str_length] = bad_data_char;
+
+      // Read the header Station ID for this header
+      hdr_idx = use_arr_vars ? i_hdr : header_data.sid_idx_array[i_hdr];
+      str_length = header_data.sid_array[hdr_idx].length();
+      if (str_length > sid_len) str_length = sid_len;
+      strncpy(hdr_sid_str, header_data.sid_array[hdr_idx].c_str(), str_length);
+      hdr_sid_str[str_length] = bad_data_char;
+
+      // Read the valid time for this header
+      hdr_idx = use_arr_vars ? i_hdr : header_data.vld_idx_array[i_hdr];
+      if((vld_it = vld_ut_map.find(hdr_idx)) != vld_ut_map.end()) {
+         hdr_ut = vld_it->second;
+      }
+      else {
+         str_length = header_data.vld_array[hdr_idx].length();
+         if (str_length > vld_len) str_length = vld_len;
+         strncpy(hdr_vld_str, header_data.vld_array[hdr_idx].c_str(), str_length);
+         hdr_vld_str[str_length] = bad_data_char;
+
+         // Convert string to a unixtime
+         hdr_ut = timestring_to_unix(hdr_vld_str);
+         vld_ut_map[hdr_idx] = hdr_ut;
+      }
+
+      obs_tbl.add_hdr(header_data.lat_array[i_hdr],
+                      header_data.lon_array[i_hdr],
+                      header_data.elv_array[i_hdr],
+                      hdr_typ_str, hdr_sid_str, hdr_ut);
+   }
+
    // Process each observation in the file
-   int str_length, block_size;
    for(int i_block_start_idx=0; i_block_start_idx<obs_count; i_block_start_idx+=block_size) {
       block_size = (obs_count - i_block_start_idx);
       if (block_size > BUFFER_SIZE) block_size = BUFFER_SIZE;
@@ -769,7 +827,6 @@ void process_obs_file(int i_nc) {
          exit(1);
       }
 
-      int hdr_idx;
       strcpy(obs_qty_str, "");
       for(int i_block_idx=0; i_block_idx<block_size; i_block_idx++) {
          i_obs = i_block_start_idx + i_block_idx;
@@ -797,32 +854,6 @@ void process_obs_file(int i_nc) {
             continue;
          }
 
-         // Read the corresponding header array for this observation
-         hdr_arr[0] = header_data.lat_array[headerOffset];
-         hdr_arr[1] = header_data.lon_array[headerOffset];
-         hdr_arr[2] = header_data.elv_array[headerOffset];
-
-         // Read the corresponding header type for this observation
-         hdr_idx = use_arr_vars ? headerOffset : header_data.typ_idx_array[headerOffset];
-         str_length = header_data.typ_array[hdr_idx].length();
-         if (str_length > typ_len) str_length = typ_len;
-         strncpy(hdr_typ_str, header_data.typ_array[hdr_idx].c_str(), str_length);
-         hdr_typ_str[str_length] = bad_data_char;
-
-         // Read the corresponding header Station ID for this observation
-         hdr_idx = use_arr_vars ? headerOffset : header_data.sid_idx_array[headerOffset];
-         str_length = header_data.sid_array[hdr_idx].length();
-         if (str_length > sid_len) str_length = sid_len;
-         strncpy(hdr_sid_str, header_data.sid_array[hdr_idx].c_str(), str_length);
-         hdr_sid_str[str_length] = bad_data_char;
-
-         // Read the corresponding valid time for this observation
-         hdr_idx = use_arr_vars ? headerOffset : header_data.vld_idx_array[headerOffset];
-         str_length = header_data.vld_array[hdr_idx].length();
-         if (str_length > vld_len) str_length = vld_len;
-         strncpy(hdr_vld_str, header_data.vld_array[hdr_idx].c_str(), str_length);
-         hdr_vld_str[str_length] = bad_data_char;
-
          // Store the variable name
          int grib_code = obs_arr[1];
          if (use_var_id && grib_code < var_names.n()) {
@@ -865,28 +896,36 @@ void process_obs_file(int i_nc) {
             }
          }
 
-         // Convert string to a unixtime
-         hdr_ut = timestring_to_unix(hdr_vld_str);
-
-         // Check each conf_info.vx_pd object to see if this observation
-         // should be added
-         for(j=0; j<conf_info.get_n_vx(); j++) {
-
-            // Check for no forecast fields
-            if(conf_info.vx_opt[j].vx_pd.fcst_dpa.n_planes() == 0) continue;
-
-            // Attempt to add the observation to the conf_info.vx_pd object
-            conf_info.vx_opt[j].vx_pd.add_point_obs(hdr_arr,
-                                         hdr_typ_str, hdr_sid_str,
-                                         hdr_ut, obs_qty_str, obs_arr,
-                                         grid, var_name.c_str());
-         }
+         // Store the observation to be matched below
+         obs_tbl.add_obs(headerOffset, var_name.c_str(), obs_arr[1],
+                         obs_arr[2], obs_arr[3], obs_arr[4], obs_qty_str);
 
          obs_arr[1] = grib_code;
       }
 
    } // end for i_block_start_idx
 
+   // Compute the grid location of each header once
+   obs_tbl.set_grid(grid);
+
+   mlog << Debug(3)
+        << "Stored " << obs_tbl.n_obs() << " observations from "
+        << obs_tbl.n_hdr() << " messages in " << obs_tbl.n_bytes()
+        << " bytes of memory.\n";
+
+   // Check each conf_info.vx_pd object to see which observations
+   // should be added.  The tasks share the read-only table and each
+   // one adds its pairs in file order, so they run concurrently.
+#pragma omp parallel for schedule(dynamic)
+   for(j=0; j<conf_info.get_n_vx(); j++) {
+
+      // Check for no forecast fields
+      if(conf_info.vx_opt[j].vx_pd.fcst_dpa.n_planes() == 0) continue;
+
+      // Add the matching observations to the conf_info.vx_pd object
+      conf_info.vx_opt[j].vx_pd.add_point_obs(obs_tbl);
+   }
+
    // Deallocate and clean up
    if(obs_in) {
       delete obs_in;
@@ -909,6 +948,7 @@ void process_scores() {
    CTSInfo       *cts_info   = (CTSInfo *)       0;
    MCTSInfo       mcts_info;
    VL1L2Info     *vl1l2_info = (VL1L2Info *)     0;
+   PerfTimer timer("compute_scores");
 
    mlog << Debug(2)
         << "\n" << sep_str << "\n\n";
@@ -2101,9 +2141,13 @@ void finish_txt_files() {
 
 void clean_up() {
 
+   PerfTimer output_timer("write_output");
+
    // Close the output text files that were open for writing
    finish_txt_files();
 
+   output_timer.stop();
+
    // Deallocate memory for data files
    if(fcst_mtddf) { delete fcst_mtddf; fcst_mtddf = (Met2dDataFile *) 0; }
 
@@ -47,8 +47,10 @@ using namespace std;
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <vector>
 
 #include "series_analysis.h"
+#include "series_data_cube.h"
 
 #include "vx_statistics.h"
 #include "vx_nc_util.h"
@@ -74,10 +76,19 @@ static bool read_single_entry(VarInfo *, const ConcatString &,
                               const GrdFileType, DataPlane &, Grid &);
 
 static void process_scores();
-
-static void do_cts   (int, const PairDataPoint *);
-static void do_mcts  (int, const PairDataPoint *);
-static void do_cnt   (int, const PairDataPoint *);
+static void process_scores_multi_pass(int &, int &);
+static void process_scores_single_pass(int &, int &);
+static void read_series_entry(int, DataPlane &, DataPlane &,
+                              DataPlane &, DataPlane &, bool &, bool &);
+static void do_block_stats(const vector<int> &, const PairDataPoint *,
+                           int &, int &);
+static bool check_point_pairs(int, int, const PairDataPoint *,
+                              int &, int &);
+static void do_point_stats(int, const PairDataPoint *, gsl_rng *);
+
+static void do_cts   (int, const PairDataPoint *, gsl_rng *);
+static void do_mcts  (int, const PairDataPoint *, gsl_rng *);
+static void do_cnt   (int, const PairDataPoint *, gsl_rng *);
 static void do_sl1l2 (int, const PairDataPoint *);
 static void do_pct   (int, const PairDataPoint *);
 
@@ -98,6 +109,7 @@ static void add_nc_var(const ConcatString &, const ConcatString &,
                        const ConcatString &, const ConcatString &,
                        const ConcatString &, double);
 static void put_nc_val(int, const ConcatString &, float);
+static void write_nc_block(const vector<int> &);
 
 static void set_range(const unixtime &, unixtime &, unixtime &);
 static void set_range(const int &, int &, int &);
@@ -122,9 +134,15 @@ int main(int argc, char *argv[]) {
    // Set handler to be called for memory allocation error
    set_new_handler(oom);
 
+   // Enable profiling, if requested
+   mperf.init(program_name);
+
    // Process the command line arguments
    process_command_line(argc, argv);
 
+   // Initialize OpenMP
+   init_openmp();
+
    // Compute the scores and write them out
    process_scores();
 
@@ -339,6 +357,16 @@ void process_grid(const Grid &fcst_grid, const Grid &obs_grid) {
    conf_info.process_masks(grid);
 
    // Compute the number of reads required
+   if(conf_info.single_pass_flag) {
+      n_reads = 1;
+
+      mlog << Debug(2)
+           << "Computing statistics using a single pass through the "
+           << grid.nx() << " x " << grid.ny() << " grid.\n";
+
+      return;
+   }
+
    n_reads = nint(ceil((double) nxy / conf_info.block_size));
 
    mlog << Debug(2)
@@ -400,6 +428,7 @@ void get_series_data(int i_series,
                      VarInfo *fcst_info, VarInfo *obs_info,
                      DataPlane &fcst_dp, DataPlane &obs_dp) {
    Grid fcst_grid, obs_grid;
+   PerfTimer timer("read_data");
 
    mlog << Debug(2)
         << "Processing series entry " << i_series + 1 << " of "
@@ -653,20 +682,89 @@ bool read_single_entry(VarInfo *info, const ConcatString &cur_file,
 ////////////////////////////////////////////////////////////////////////
 
 void process_scores() {
-   int i, x, y, i_read, i_series, i_point, i_fcst;
-   VarInfo *fcst_info = (VarInfo *) 0;
-   VarInfo *obs_info  = (VarInfo *) 0;
+
+   // Number of points skipped due to valid data threshold
+   int n_skip_zero = 0;
+   int n_skip_pos  = 0;
+
+   // Determine which statistics are computed for each point
+   bool is_prob = conf_info.fcst_info[0]->is_prob();
+   cts_flag   = !is_prob &&
+                (conf_info.output_stats[stat_fho].n() +
+                 conf_info.output_stats[stat_ctc].n() +
+                 conf_info.output_stats[stat_cts].n()) > 0;
+   mcts_flag  = !is_prob &&
+                (conf_info.output_stats[stat_mctc].n() +
+                 conf_info.output_stats[stat_mcts].n()) > 0;
+   cnt_flag   = !is_prob &&
+                conf_info.output_stats[stat_cnt].n() > 0;
+   sl1l2_flag = !is_prob &&
+                (conf_info.output_stats[stat_sl1l2].n()  > 0 ||
+                 conf_info.output_stats[stat_sal1l2].n() > 0);
+   pct_flag   = is_prob &&
+                (conf_info.output_stats[stat_pct].n() +
+                 conf_info.output_stats[stat_pstd].n() +
+                 conf_info.output_stats[stat_pjc].n() +
+                 conf_info.output_stats[stat_prc].n()) > 0;
+
+   // Read the input data once or once per block of grid points,
+   // writing the statistics for each block as it is completed
+   if(conf_info.single_pass_flag) {
+      process_scores_single_pass(n_skip_zero, n_skip_pos);
+   }
+   else {
+      process_scores_multi_pass(n_skip_zero, n_skip_pos);
+   }
+
+   // Add time range information to the global NetCDF attributes
+   add_att(nc_out, "fcst_init_beg",  (string)unix_to_yyyymmdd_hhmmss(fcst_init_beg));
+   add_att(nc_out, "fcst_init_end",  (string)unix_to_yyyymmdd_hhmmss(fcst_init_end));
+   add_att(nc_out, "fcst_valid_beg", (string)unix_to_yyyymmdd_hhmmss(fcst_valid_beg));
+   add_att(nc_out, "fcst_valid_end", (string)unix_to_yyyymmdd_hhmmss(fcst_valid_end));
+   add_att(nc_out, "fcst_lead_beg",  (string)sec_to_hhmmss(fcst_lead_beg));
+   add_att(nc_out, "fcst_lead_end",  (string)sec_to_hhmmss(fcst_lead_end));
+   add_att(nc_out, "obs_init_beg",   (string)unix_to_yyyymmdd_hhmmss(obs_init_beg));
+   add_att(nc_out, "obs_init_end",   (string)unix_to_yyyymmdd_hhmmss(obs_init_end));
+   add_att(nc_out, "obs_valid_beg",  (string)unix_to_yyyymmdd_hhmmss(obs_valid_beg));
+   add_att(nc_out, "obs_valid_end",  (string)unix_to_yyyymmdd_hhmmss(obs_valid_end));
+   add_att(nc_out, "obs_lead_beg",   (string)sec_to_hhmmss(obs_lead_beg));
+   add_att(nc_out, "obs_lead_end",   (string)sec_to_hhmmss(obs_lead_end));
+
+   // Print summary counts
+   mlog << Debug(2)
+        << "Finished processing statistics for "
+        << nxy - n_skip_zero - n_skip_pos << " of " << nxy
+        << " grid points.\n"
+        << "Skipped " << n_skip_zero << " of " << nxy
+        << " points with no valid data.\n"
+        << "Skipped " << n_skip_pos << " of " << nxy
+        << " points that did not meet the valid data threshold.\n";
+
+   // Print config file suggestions about missing data
+   if(n_skip_pos > 0 && conf_info.vld_data_thresh == 1.0) {
+      mlog << Debug(2)
+           << "Some points skipped due to missing data:\n"
+           << "Consider decreasing \"vld_thresh\" in the config file "
+           << "to include more points.\n"
+           << "Consider requesting \"TOTAL\" from \"output_stats\" "
+           << "in the config file to see the valid data counts.\n";
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void process_scores_multi_pass(int &n_skip_zero, int &n_skip_pos) {
+   int i, x, y, i_read, i_series, i_point;
    PairDataPoint *pd_ptr = (PairDataPoint *) 0;
    DataPlane fcst_dp, obs_dp;
+   vector<int> block_pnt;
 
    // Climatology mean and standard deviation
    DataPlane cmn_dp, csd_dp;
    bool cmn_flag, csd_flag;
 
-   // Number of points skipped due to valid data threshold
-   int n_skip_zero = 0;
-   int n_skip_pos  = 0;
-
    // Allocate space to store the pairs for each grid point
    pd_ptr = new PairDataPoint [conf_info.block_size];
    for(i=0; i<conf_info.block_size; i++) pd_ptr[i].extend(n_series);
@@ -683,17 +781,9 @@ void process_scores() {
       // Loop over the series variable
       for(i_series=0; i_series<n_series; i_series++) {
 
-         // Get the index for the forecast and climo VarInfo objects
-         i_fcst = (conf_info.get_n_fcst() > 1 ? i_series : 0);
-
-         // Store the current VarInfo objects
-         fcst_info = conf_info.fcst_info[i_fcst];
-         obs_info  = (conf_info.get_n_obs() > 1 ?
-                      conf_info.obs_info[i_series] :
-                      conf_info.obs_info[0]);
-
          // Retrieve the data planes for the current series entry
-         get_series_data(i_series, fcst_info, obs_info, fcst_dp, obs_dp);
+         read_series_entry(i_series, fcst_dp, obs_dp,
+                           cmn_dp, csd_dp, cmn_flag, csd_flag);
 
          if(i_series == 0) {
             mlog << Debug(2)
@@ -702,36 +792,11 @@ void process_scores() {
                  << min(i_point + conf_info.block_size, nxy) << ".\n";
          }
 
-         // Read climatology data for the current series entry
-         cmn_dp = read_climo_data_plane(
-                  conf_info.conf.lookup_array(conf_key_climo_mean_field, false),
-                  i_fcst, fcst_dp.valid(), grid);
-         csd_dp = read_climo_data_plane(
-                  conf_info.conf.lookup_array(conf_key_climo_stdev_field, false),
-                  i_fcst, fcst_dp.valid(), grid);
-
-         cmn_flag = (cmn_dp.nx() == fcst_dp.nx() && cmn_dp.ny() == fcst_dp.ny());
-         csd_flag = (csd_dp.nx() == fcst_dp.nx() && csd_dp.ny() == fcst_dp.ny());
-
-         mlog << Debug(3)
-           << "Found " << (cmn_flag ? 0 : 1)
-           << " climatology mean and " << (csd_flag == 0 ? 0 : 1)
-           << " climatology standard deviation field(s) for forecast "
-           << fcst_info->magic_str() << ".\n";
-
-         // Setup the output NetCDF file on the first pass
-         if(nc_out == (NcFile *) 0) setup_nc_file(fcst_info, obs_info);
-
-         // Update timing info
-         set_range(fcst_dp.init(),  fcst_init_beg,  fcst_init_end);
-         set_range(fcst_dp.valid(), fcst_valid_beg, fcst_valid_end);
-         set_range(fcst_dp.lead(),  fcst_lead_beg,  fcst_lead_end);
-         set_range(obs_dp.init(),   obs_init_beg,   obs_init_end);
-         set_range(obs_dp.valid(),  obs_valid_beg,  obs_valid_end);
-         set_range(obs_dp.lead(),   obs_lead_beg,   obs_lead_end);
-
          // Store matched pairs for each grid point
-         for(i=0; i<conf_info.block_size && (i_point+i)<nxy; i++) {
+#pragma omp parallel for private(x, y)
+         for(i=0; i<conf_info.block_size; i++) {
+
+            if(i_point+i >= nxy) continue;
 
             // Convert n to x, y
             DefaultTO.one_to_two(grid.nx(), grid.ny(), i_point+i, x, y);
@@ -753,125 +818,327 @@ void process_scores() {
       } // end for i_series
 
       // Compute statistics for each grid point in the block
+      block_pnt.clear();
       for(i=0; i<conf_info.block_size && (i_point+i)<nxy; i++) {
+         block_pnt.push_back(i_point+i);
+      }
+      do_block_stats(block_pnt, pd_ptr, n_skip_zero, n_skip_pos);
+
+      // Erase the data
+      for(i=0; i<conf_info.block_size; i++) {
+         pd_ptr[i].f_na.erase();
+         pd_ptr[i].o_na.erase();
+         pd_ptr[i].cmn_na.erase();
+         pd_ptr[i].csd_na.erase();
+      }
+
+   } // end for i_read
 
-         // Determine x,y location
-         DefaultTO.one_to_two(grid.nx(), grid.ny(), i_point+i, x, y);
+   // Clean up
+   if(pd_ptr) { delete [] pd_ptr; pd_ptr = (PairDataPoint *) 0; }
 
-         // Check for the required number of matched pairs
-         if(pd_ptr[i].f_na.n()/(double) n_series < conf_info.vld_data_thresh) {
-            mlog << Debug(4)
-                 << "[" << i+1 << " of " << conf_info.block_size
-                 << "] Skipping point (" << x << ", " << y << ") with "
-                 << pd_ptr[i].f_na.n() << " matched pairs.\n";
+   return;
+}
 
-            // Keep track of the number of points skipped
-            if(pd_ptr[i].f_na.n() == 0) n_skip_zero++;
-            else                        n_skip_pos++;
+////////////////////////////////////////////////////////////////////////
 
-            continue;
-         }
-         else {
-            mlog << Debug(4)
-                 << "[" << i+1 << " of " << conf_info.block_size
-                 << "] Processing point (" << x << ", " << y << ") with "
-                 << pd_ptr[i].n_obs << " matched pairs.\n";
-         }
+void process_scores_single_pass(int &n_skip_zero, int &n_skip_pos) {
+   int i, j, x, y, i_series, i_point;
+   PairDataPoint *pd_ptr = (PairDataPoint *) 0;
+   DataPlane fcst_dp, obs_dp;
+   SeriesDataCube cube;
+   IntArray pnt_idx;
+   float *f_ptr, *o_ptr, *cmn_ptr, *csd_ptr;
+   const float *fc_ptr, *oc_ptr, *cmnc_ptr, *csdc_ptr;
+   vector<int> block_pnt;
 
-         // Compute contingency table counts and statistics
-         if(!conf_info.fcst_info[0]->is_prob() &&
-            (conf_info.output_stats[stat_fho].n() +
-             conf_info.output_stats[stat_ctc].n() +
-             conf_info.output_stats[stat_cts].n()) > 0) {
-            do_cts(i_point+i, &pd_ptr[i]);
-         }
+   // Climatology mean and standard deviation
+   DataPlane cmn_dp, csd_dp;
+   bool cmn_flag, csd_flag;
 
-         // Compute multi-category contingency table counts and statistics
-         if(!conf_info.fcst_info[0]->is_prob() &&
-            (conf_info.output_stats[stat_mctc].n() +
-             conf_info.output_stats[stat_mcts].n()) > 0) {
-            do_mcts(i_point+i, &pd_ptr[i]);
-         }
+   // Read each series entry once, storing the masked points
+   for(i_series=0; i_series<n_series; i_series++) {
 
-         // Compute continuous statistics
-         if(!conf_info.fcst_info[0]->is_prob() &&
-            conf_info.output_stats[stat_cnt].n() > 0) {
-            do_cnt(i_point+i, &pd_ptr[i]);
-         }
+      // Retrieve the data planes for the current series entry
+      read_series_entry(i_series, fcst_dp, obs_dp,
+                        cmn_dp, csd_dp, cmn_flag, csd_flag);
 
-         // Compute partial sums
-         if(!conf_info.fcst_info[0]->is_prob() &&
-            (conf_info.output_stats[stat_sl1l2].n()  > 0 ||
-             conf_info.output_stats[stat_sal1l2].n() > 0)) {
-            do_sl1l2(i_point+i, &pd_ptr[i]);
+      // The grid and masking region are defined by the first entry
+      if(i_series == 0) {
+
+         // Store the grid point index for each masked point
+         for(i=0; i<nxy; i++) {
+            DefaultTO.one_to_two(grid.nx(), grid.ny(), i, x, y);
+            if(conf_info.mask_area(x, y)) pnt_idx.add(i);
          }
 
-         // Compute probabilistics counts and statistics
-         if(conf_info.fcst_info[0]->is_prob() &&
-            (conf_info.output_stats[stat_pct].n() +
-             conf_info.output_stats[stat_pstd].n() +
-             conf_info.output_stats[stat_pjc].n() +
-             conf_info.output_stats[stat_prc].n()) > 0) {
-            do_pct(i_point+i, &pd_ptr[i]);
+         if(pnt_idx.n() > 0) {
+
+            cube.set_size(pnt_idx.n(), n_series,
+                          (bigint) conf_info.single_pass_max_mb*1024*1024,
+                          conf_info.tmp_dir.c_str());
+
+            mlog << Debug(2)
+                 << "Storing the time series for " << pnt_idx.n()
+                 << " masked grid points (" << cube.n_bytes()
+                 << " bytes) in "
+                 << (cube.is_mapped() ?
+                     "a memory-mapped scratch file" : "memory")
+                 << " to read the data in a single pass.\n";
          }
+      }
+
+      // Nothing to store for an empty mask, but keep reading the
+      // series entries to update the timing information
+      if(pnt_idx.n() == 0) continue;
+
+      f_ptr   = cube.plane(i_series, SeriesField_Fcst);
+      o_ptr   = cube.plane(i_series, SeriesField_Obs);
+      cmn_ptr = cube.plane(i_series, SeriesField_Cmn);
+      csd_ptr = cube.plane(i_series, SeriesField_Csd);
+
+      // Store the data for each masked point, leaving bad data
+      // in the forecast for points to be skipped
+      for(i=0; i<pnt_idx.n(); i++) {
+
+         // Convert n to x, y
+         DefaultTO.one_to_two(grid.nx(), grid.ny(), pnt_idx[i], x, y);
+
+         // Skip bad data
+         if(is_bad_data(fcst_dp(x, y))              ||
+            is_bad_data(obs_dp(x,y))                ||
+            (cmn_flag && is_bad_data(cmn_dp(x, y))) ||
+            (csd_flag && is_bad_data(csd_dp(x, y)))) continue;
+
+         f_ptr[i]   = (float) fcst_dp(x, y);
+         o_ptr[i]   = (float) obs_dp(x, y);
+         cmn_ptr[i] = (cmn_flag ? (float) cmn_dp(x, y) : bad_data_float);
+         csd_ptr[i] = (csd_flag ? (float) csd_dp(x, y) : bad_data_float);
+
       } // end for i
 
-      // Erase the data
-      for(i=0; i<conf_info.block_size; i++) {
-         pd_ptr[i].f_na.erase();
-         pd_ptr[i].o_na.erase();
-         pd_ptr[i].cmn_na.erase();
-         pd_ptr[i].csd_na.erase();
+   } // end for i_series
+
+   // Allocate space to store the pairs for each grid point
+   pd_ptr = new PairDataPoint [conf_info.block_size];
+   for(i=0; i<conf_info.block_size; i++) pd_ptr[i].extend(n_series);
+
+   // Compute statistics for blocks of masked points
+   for(i_point=0; i_point<pnt_idx.n(); i_point+=conf_info.block_size) {
+
+      // Initialize PairDataPoint objects
+      for(i=0; i<conf_info.block_size; i++) pd_ptr[i].erase();
+
+      // Build the matched pairs for each point in the block
+      for(i_series=0; i_series<n_series; i_series++) {
+
+         fc_ptr   = cube.plane(i_series, SeriesField_Fcst);
+         oc_ptr   = cube.plane(i_series, SeriesField_Obs);
+         cmnc_ptr = cube.plane(i_series, SeriesField_Cmn);
+         csdc_ptr = cube.plane(i_series, SeriesField_Csd);
+
+#pragma omp parallel for private(j)
+         for(i=0; i<conf_info.block_size; i++) {
+
+            if(i_point+i >= pnt_idx.n()) continue;
+
+            j = i_point + i;
+
+            if(is_bad_data(fc_ptr[j])) continue;
+
+            pd_ptr[i].add_grid_pair(fc_ptr[j], oc_ptr[j],
+                         (is_bad_data(cmnc_ptr[j]) ? bad_data_double : cmnc_ptr[j]),
+                         (is_bad_data(csdc_ptr[j]) ? bad_data_double : csdc_ptr[j]),
+                         default_grid_weight);
+         }
+      } // end for i_series
+
+      // Compute statistics for each point in the block
+      block_pnt.clear();
+      for(i=0; i<conf_info.block_size && (i_point+i)<pnt_idx.n(); i++) {
+         block_pnt.push_back(pnt_idx[i_point+i]);
       }
+      do_block_stats(block_pnt, pd_ptr, n_skip_zero, n_skip_pos);
 
-   } // end for i_read
+   } // end for i_point
 
-   // Add time range information to the global NetCDF attributes
-   add_att(nc_out, "fcst_init_beg",  (string)unix_to_yyyymmdd_hhmmss(fcst_init_beg));
-   add_att(nc_out, "fcst_init_end",  (string)unix_to_yyyymmdd_hhmmss(fcst_init_end));
-   add_att(nc_out, "fcst_valid_beg", (string)unix_to_yyyymmdd_hhmmss(fcst_valid_beg));
-   add_att(nc_out, "fcst_valid_end", (string)unix_to_yyyymmdd_hhmmss(fcst_valid_end));
-   add_att(nc_out, "fcst_lead_beg",  (string)sec_to_hhmmss(fcst_lead_beg));
-   add_att(nc_out, "fcst_lead_end",  (string)sec_to_hhmmss(fcst_lead_end));
-   add_att(nc_out, "obs_init_beg",   (string)unix_to_yyyymmdd_hhmmss(obs_init_beg));
-   add_att(nc_out, "obs_init_end",   (string)unix_to_yyyymmdd_hhmmss(obs_init_end));
-   add_att(nc_out, "obs_valid_beg",  (string)unix_to_yyyymmdd_hhmmss(obs_valid_beg));
-   add_att(nc_out, "obs_valid_end",  (string)unix_to_yyyymmdd_hhmmss(obs_valid_end));
-   add_att(nc_out, "obs_lead_beg",   (string)sec_to_hhmmss(obs_lead_beg));
-   add_att(nc_out, "obs_lead_end",   (string)sec_to_hhmmss(obs_lead_end));
+   // Points outside the mask have no valid data
+   n_skip_zero += nxy - pnt_idx.n();
 
    // Clean up
    if(pd_ptr) { delete [] pd_ptr; pd_ptr = (PairDataPoint *) 0; }
 
-   // Print summary counts
-   mlog << Debug(2)
-        << "Finished processing statistics for "
-        << nxy - n_skip_zero - n_skip_pos << " of " << nxy
-        << " grid points.\n"
-        << "Skipped " << n_skip_zero << " of " << nxy
-        << " points with no valid data.\n"
-        << "Skipped " << n_skip_pos << " of " << nxy
-        << " points that did not meet the valid data threshold.\n";
+   return;
+}
 
-   // Print config file suggestions about missing data
-   if(n_skip_pos > 0 && conf_info.vld_data_thresh == 1.0) {
-      mlog << Debug(2)
-           << "Some points skipped due to missing data:\n"
-           << "Consider decreasing \"vld_thresh\" in the config file "
-           << "to include more points.\n"
-           << "Consider requesting \"TOTAL\" from \"output_stats\" "
-           << "in the config file to see the valid data counts.\n";
+////////////////////////////////////////////////////////////////////////
+
+void read_series_entry(int i_series,
+                       DataPlane &fcst_dp, DataPlane &obs_dp,
+                       DataPlane &cmn_dp, DataPlane &csd_dp,
+                       bool &cmn_flag, bool &csd_flag) {
+   int i_fcst;
+   VarInfo *fcst_info = (VarInfo *) 0;
+   VarInfo *obs_info  = (VarInfo *) 0;
+
+   // Get the index for the forecast and climo VarInfo objects
+   i_fcst = (conf_info.get_n_fcst() > 1 ? i_series : 0);
+
+   // Store the current VarInfo objects
+   fcst_info = conf_info.fcst_info[i_fcst];
+   obs_info  = (conf_info.get_n_obs() > 1 ?
+                conf_info.obs_info[i_series] :
+                conf_info.obs_info[0]);
+
+   // Retrieve the data planes for the current series entry
+   get_series_data(i_series, fcst_info, obs_info, fcst_dp, obs_dp);
+
+   // Read climatology data for the current series entry
+   cmn_dp = read_climo_data_plane(
+            conf_info.conf.lookup_array(conf_key_climo_mean_field, false),
+            i_fcst, fcst_dp.valid(), grid);
+   csd_dp = read_climo_data_plane(
+            conf_info.conf.lookup_array(conf_key_climo_stdev_field, false),
+            i_fcst, fcst_dp.valid(), grid);
+
+   cmn_flag = (cmn_dp.nx() == fcst_dp.nx() && cmn_dp.ny() == fcst_dp.ny());
+   csd_flag = (csd_dp.nx() == fcst_dp.nx() && csd_dp.ny() == fcst_dp.ny());
+
+   mlog << Debug(3)
+     << "Found " << (cmn_flag ? 0 : 1)
+     << " climatology mean and " << (csd_flag == 0 ? 0 : 1)
+     << " climatology standard deviation field(s) for forecast "
+     << fcst_info->magic_str() << ".\n";
+
+   // Setup the output NetCDF file on the first pass
+   if(nc_out == (NcFile *) 0) setup_nc_file(fcst_info, obs_info);
+
+   // Update timing info
+   set_range(fcst_dp.init(),  fcst_init_beg,  fcst_init_end);
+   set_range(fcst_dp.valid(), fcst_valid_beg, fcst_valid_end);
+   set_range(fcst_dp.lead(),  fcst_lead_beg,  fcst_lead_end);
+   set_range(obs_dp.init(),   obs_init_beg,   obs_init_end);
+   set_range(obs_dp.valid(),  obs_valid_beg,  obs_valid_end);
+   set_range(obs_dp.lead(),   obs_lead_beg,   obs_lead_end);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+//
+// Compute statistics for each point in a block concurrently.  The pairs
+// for each point and the output array entries written for it are
+// independent of the other points.  One random number seed is drawn for
+// each point so that the bootstrap results do not depend on the number
+// of threads.  The points are checked and logged in order beforehand,
+// and the statistics for the block are written once it is complete.
+//
+////////////////////////////////////////////////////////////////////////
+
+void do_block_stats(const vector<int> &block_pnt,
+                    const PairDataPoint *pd_ptr,
+                    int &n_skip_zero, int &n_skip_pos) {
+   int i;
+   int n_block = (int) block_pnt.size();
+   vector<char> pnt_ok(n_block);
+   vector<unsigned long> seeds(n_block);
+   vector<gsl_rng *> rngs(met_num_threads(), (gsl_rng *) 0);
+   PerfTimer timer("point_stats");
+
+   mperf.add_count("grid_points", n_block);
+
+   // Statistics are buffered for the points in this block
+   stat_block_pnt = block_pnt;
+
+   // Check for the required number of matched pairs
+   for(i=0; i<n_block; i++) {
+      pnt_ok[i] = check_point_pairs(block_pnt[i], i, &pd_ptr[i],
+                                    n_skip_zero, n_skip_pos);
+   }
+
+   for(i=0; i<n_block; i++) seeds[i] = rng_get(rng_ptr);
+   for(i=0; i<(int) rngs.size(); i++) rng_clone(rngs[i], rng_ptr);
+
+#pragma omp parallel for schedule(dynamic)
+   for(i=0; i<n_block; i++) {
+      if(!pnt_ok[i]) continue;
+      gsl_rng *r = rngs[met_thread_num()];
+      rng_seed(r, seeds[i]);
+      do_point_stats(block_pnt[i], &pd_ptr[i], r);
    }
 
+   for(i=0; i<(int) rngs.size(); i++) rng_free(rngs[i]);
+
+   // Write the statistics for this block to the output NetCDF file
+   write_nc_block(block_pnt);
+
    return;
 }
 
 ////////////////////////////////////////////////////////////////////////
 
-void do_cts(int n, const PairDataPoint *pd_ptr) {
-   int i, j;
+bool check_point_pairs(int n, int i_block, const PairDataPoint *pd_ptr,
+                       int &n_skip_zero, int &n_skip_pos) {
+   int x, y;
+
+   // Determine x,y location
+   DefaultTO.one_to_two(grid.nx(), grid.ny(), n, x, y);
+
+   // Check for the required number of matched pairs
+   if(pd_ptr->f_na.n()/(double) n_series < conf_info.vld_data_thresh) {
+      mlog << Debug(4)
+           << "[" << i_block+1 << " of " << conf_info.block_size
+           << "] Skipping point (" << x << ", " << y << ") with "
+           << pd_ptr->f_na.n() << " matched pairs.\n";
+
+      // Keep track of the number of points skipped
+      if(pd_ptr->f_na.n() == 0) n_skip_zero++;
+      else                      n_skip_pos++;
+
+      return(false);
+   }
+
+   mlog << Debug(4)
+        << "[" << i_block+1 << " of " << conf_info.block_size
+        << "] Processing point (" << x << ", " << y << ") with "
+        << pd_ptr->n_obs << " matched pairs.\n";
+
+   if(cts_flag)   mlog << Debug(4) << "Computing Categorical Statistics.\n";
+   if(mcts_flag)  mlog << Debug(4) << "Computing Multi-Category Statistics.\n";
+   if(cnt_flag)   mlog << Debug(4) << "Computing Continuous Statistics.\n";
+   if(sl1l2_flag) mlog << Debug(4) << "Computing Scalar Partial Sums.\n";
+   if(pct_flag)   mlog << Debug(4) << "Computing Probabilistic Statistics.\n";
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void do_point_stats(int n, const PairDataPoint *pd_ptr, gsl_rng *r) {
 
-   mlog << Debug(4) << "Computing Categorical Statistics.\n";
+   // Compute contingency table counts and statistics
+   if(cts_flag) do_cts(n, pd_ptr, r);
+
+   // Compute multi-category contingency table counts and statistics
+   if(mcts_flag) do_mcts(n, pd_ptr, r);
+
+   // Compute continuous statistics
+   if(cnt_flag) do_cnt(n, pd_ptr, r);
+
+   // Compute partial sums
+   if(sl1l2_flag) do_sl1l2(n, pd_ptr);
+
+   // Compute probabilistics counts and statistics
+   if(pct_flag) do_pct(n, pd_ptr);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void do_cts(int n, const PairDataPoint *pd_ptr, gsl_rng *r) {
+   int i, j;
 
    // Allocate objects to store categorical statistics
    int n_cts = conf_info.fcat_ta.n();
@@ -891,13 +1158,13 @@ void do_cts(int n, const PairDataPoint *pd_ptr) {
    // Compute the counts, stats, normal confidence intervals, and
    // bootstrap confidence intervals
    if(conf_info.boot_interval == BootIntervalType_BCA) {
-      compute_cts_stats_ci_bca(rng_ptr, *pd_ptr,
+      compute_cts_stats_ci_bca(r, *pd_ptr,
          conf_info.n_boot_rep,
          cts_info, n_cts, true,
          conf_info.rank_corr_flag, conf_info.tmp_dir.c_str());
    }
    else {
-      compute_cts_stats_ci_perc(rng_ptr, *pd_ptr,
+      compute_cts_stats_ci_perc(r, *pd_ptr,
          conf_info.n_boot_rep, conf_info.boot_rep_prop,
          cts_info, n_cts, true,
          conf_info.rank_corr_flag, conf_info.tmp_dir.c_str());
@@ -933,11 +1200,9 @@ void do_cts(int n, const PairDataPoint *pd_ptr) {
 
 ////////////////////////////////////////////////////////////////////////
 
-void do_mcts(int n, const PairDataPoint *pd_ptr) {
+void do_mcts(int n, const PairDataPoint *pd_ptr, gsl_rng *r) {
    int i;
 
-   mlog << Debug(4) << "Computing Multi-Category Statistics.\n";
-
    // Object to store multi-category statistics
    MCTSInfo mcts_info;
 
@@ -954,13 +1219,13 @@ void do_mcts(int n, const PairDataPoint *pd_ptr) {
    // Compute the counts, stats, normal confidence intervals, and
    // bootstrap confidence intervals
    if(conf_info.boot_interval == BootIntervalType_BCA) {
-      compute_mcts_stats_ci_bca(rng_ptr, *pd_ptr,
+      compute_mcts_stats_ci_bca(r, *pd_ptr,
          conf_info.n_boot_rep,
          mcts_info, true,
          conf_info.rank_corr_flag, conf_info.tmp_dir.c_str());
    }
    else {
-      compute_mcts_stats_ci_perc(rng_ptr, *pd_ptr,
+      compute_mcts_stats_ci_perc(r, *pd_ptr,
          conf_info.n_boot_rep, conf_info.boot_rep_prop,
          mcts_info, true,
          conf_info.rank_corr_flag, conf_info.tmp_dir.c_str());
@@ -983,13 +1248,11 @@ void do_mcts(int n, const PairDataPoint *pd_ptr) {
 
 ////////////////////////////////////////////////////////////////////////
 
-void do_cnt(int n, const PairDataPoint *pd_ptr) {
+void do_cnt(int n, const PairDataPoint *pd_ptr, gsl_rng *r) {
    int i, j;
    CNTInfo cnt_info;
    PairDataPoint pd;
 
-   mlog << Debug(4) << "Computing Continuous Statistics.\n";
-
    // Process each filtering threshold
    for(i=0; i<conf_info.fcnt_ta.n(); i++) {
 
@@ -1020,13 +1283,13 @@ void do_cnt(int n, const PairDataPoint *pd_ptr) {
                          conf_info.obs_info[0]->is_precipitation());
 
       if(conf_info.boot_interval == BootIntervalType_BCA) {
-         compute_cnt_stats_ci_bca(rng_ptr, pd,
+         compute_cnt_stats_ci_bca(r, pd,
             precip_flag, conf_info.rank_corr_flag,
             conf_info.n_boot_rep,
             cnt_info, conf_info.tmp_dir.c_str());
       }
       else {
-         compute_cnt_stats_ci_perc(rng_ptr, pd,
+         compute_cnt_stats_ci_perc(r, pd,
             precip_flag, conf_info.rank_corr_flag,
             conf_info.n_boot_rep, conf_info.boot_rep_prop,
             cnt_info, conf_info.tmp_dir.c_str());
@@ -1048,8 +1311,6 @@ void do_sl1l2(int n, const PairDataPoint *pd_ptr) {
    int i, j;
    SL1L2Info s_info;
 
-   mlog << Debug(4) << "Computing Scalar Partial Sums.\n";
-
    // Loop over the continuous thresholds and compute scalar partial sums
    for(i=0; i<conf_info.fcnt_ta.n(); i++) {
 
@@ -1075,8 +1336,6 @@ void do_sl1l2(int n, const PairDataPoint *pd_ptr) {
 void do_pct(int n, const PairDataPoint *pd_ptr) {
    int i, j;
 
-   mlog << Debug(4) << "Computing Probabilistic Statistics.\n";
-
    // Object to store probabilistic statistics
    PCTInfo pct_info;
 
@@ -1160,6 +1419,7 @@ void store_stat_fho(int n, const ConcatString &col,
    }
 
    // Add map for this variable name
+#pragma omp critical(series_analysis_stat_data)
    if(stat_data.count(var_name) == 0) {
 
       // Build key
@@ -1214,6 +1474,7 @@ void store_stat_ctc(int n, const ConcatString &col,
    }
 
    // Add map for this variable name
+#pragma omp critical(series_analysis_stat_data)
    if(stat_data.count(var_name) == 0) {
 
       // Build key
@@ -1367,6 +1628,7 @@ void store_stat_cts(int n, const ConcatString &col,
       if(n_ci > 1) var_name << "_a"  << cts_info.alpha[i];
 
       // Add map for this variable name
+#pragma omp critical(series_analysis_stat_data)
       if(stat_data.count(var_name) == 0) {
 
          // Build key
@@ -1435,6 +1697,7 @@ void store_stat_mctc(int n, const ConcatString &col,
    var_name << cs_erase << "series_mctc_" << c;
 
    // Add map for this variable name
+#pragma omp critical(series_analysis_stat_data)
    if(stat_data.count(var_name) == 0) {
 
       // Build key
@@ -1502,6 +1765,7 @@ void store_stat_mcts(int n, const ConcatString &col,
       if(n_ci > 1) var_name << "_a"  << mcts_info.alpha[i];
 
       // Add map for this variable name
+#pragma omp critical(series_analysis_stat_data)
       if(stat_data.count(var_name) == 0) {
 
          // Build key
@@ -1660,6 +1924,7 @@ void store_stat_cnt(int n, const ConcatString &col,
       if(n_ci > 1) var_name << "_a"  << cnt_info.alpha[i];
 
       // Add map for this variable name
+#pragma omp critical(series_analysis_stat_data)
       if(stat_data.count(var_name) == 0) {
 
          // Build key
@@ -1722,6 +1987,7 @@ void store_stat_sl1l2(int n, const ConcatString &col,
    }
 
    // Add map for this variable name
+#pragma omp critical(series_analysis_stat_data)
    if(stat_data.count(var_name) == 0) {
 
       // Build key
@@ -1787,6 +2053,7 @@ void store_stat_pct(int n, const ConcatString &col,
             << "_obs" << pct_info.othresh.get_abbr_str();
 
    // Add map for this variable name
+#pragma omp critical(series_analysis_stat_data)
    if(stat_data.count(var_name) == 0) {
 
       // Build key
@@ -1851,6 +2118,7 @@ void store_stat_pstd(int n, const ConcatString &col,
       if(n_ci > 1) var_name << "_a"  << pct_info.alpha[i];
 
       // Add map for this variable name
+#pragma omp critical(series_analysis_stat_data)
       if(stat_data.count(var_name) == 0) {
 
          // Build key
@@ -1931,6 +2199,7 @@ void store_stat_pjc(int n, const ConcatString &col,
             << "_obs" << pct_info.othresh.get_abbr_str();
 
    // Add map for this variable name
+#pragma omp critical(series_analysis_stat_data)
    if(stat_data.count(var_name) == 0) {
 
       // Build key
@@ -1998,6 +2267,7 @@ void store_stat_prc(int n, const ConcatString &col,
    }
 
    // Add map for this variable name
+#pragma omp critical(series_analysis_stat_data)
    if(stat_data.count(var_name) == 0) {
 
       // Build key
@@ -2098,6 +2368,11 @@ void add_nc_var(const ConcatString &var_name,
    if(obs_thresh.length() > 0)  add_att(d.var, "obs_thresh", (string)obs_thresh);
    if(!is_bad_data(alpha))      add_att(d.var, "alpha", alpha);
 
+   // Allocate space for the statistic values in a block of points,
+   // initialized to bad data
+   d.buf = new float [conf_info.block_size];
+   for(int i=0; i<conf_info.block_size; i++) d.buf[i] = bad_data_float;
+
    // Store the new NcVarData object in the map
    stat_data[var_name] = d;
 
@@ -2107,35 +2382,81 @@ void add_nc_var(const ConcatString &var_name,
 ////////////////////////////////////////////////////////////////////////
 
 void put_nc_val(int n, const ConcatString &var_name, float v) {
-   int x, y;
+   float *buf = (float *) 0;
 
-   // Determine x,y location
-   DefaultTO.one_to_two(grid.nx(), grid.ny(), n, x, y);
+   // Look up the variable while no other thread is adding one
+#pragma omp critical(series_analysis_stat_data)
+   {
+      // Check for key in the map
+      if(stat_data.count(var_name) == 0) {
+         mlog << Error << "\nput_nc_val() -> "
+              << "variable name \"" << var_name
+              << "\" does not exist in the map.\n\n";
+         exit(1);
+      }
 
-   // Check for key in the map
-   if(stat_data.count(var_name) == 0) {
-      mlog << Error << "\nput_nc_val() -> "
-           << "variable name \"" << var_name
-           << "\" does not exist in the map.\n\n";
-      exit(1);
+      buf = stat_data[var_name].buf;
    }
 
-   // Get the NetCDF variable to be written
-   NcVar *var = stat_data[var_name].var;
+   // Store the current value at the location of this point in the
+   // block, which no other thread writes
+   buf[lower_bound(stat_block_pnt.begin(), stat_block_pnt.end(), n) -
+       stat_block_pnt.begin()] = v;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void write_nc_block(const vector<int> &block_pnt) {
+   int i, j, k, x, y;
+   int n_block = (int) block_pnt.size();
+   vector< pair<int,int> > pos(n_block);
+   vector<float> data(n_block);
+   map<ConcatString, NcVarData>::const_iterator it;
+   PerfTimer timer("write_output");
+
+   if(stat_data.size() == 0) return;
+
+   // Sort the points of the block by their location in the output
+   for(i=0; i<n_block; i++) {
+      DefaultTO.one_to_two(grid.nx(), grid.ny(), block_pnt[i], x, y);
+      pos[i].first  = y*grid.nx() + x;
+      pos[i].second = i;
+   }
+   sort(pos.begin(), pos.end());
 
    long offsets[2];
    long lengths[2];
-   offsets[0] = y;
-   offsets[1] = x;
-   lengths[0] = 1;
-   lengths[1] = 1;
-
-   // Store the current value
-   if(!put_nc_data(var, &v, lengths, offsets)) {
-      mlog << Error << "\nput_nc_val() -> "
-           << "error writing to variable " << var_name
-           << " for point (" << x << ", " << y << ").\n\n";
-      exit(1);
+
+   for(it=stat_data.begin(); it!=stat_data.end(); it++) {
+
+      for(i=0; i<n_block; i++) data[i] = it->second.buf[pos[i].second];
+
+      // Write each run of adjacent points in a row in a single call
+      for(i=0; i<n_block; i=j) {
+
+         y = pos[i].first / grid.nx();
+         x = pos[i].first % grid.nx();
+
+         for(j=i+1; j<n_block && pos[j].first == pos[j-1].first + 1 &&
+                    pos[j].first / grid.nx() == y; j++);
+
+         offsets[0] = y;
+         offsets[1] = x;
+         lengths[0] = 1;
+         lengths[1] = j - i;
+
+         if(!put_nc_data(it->second.var, &data[i], lengths, offsets)) {
+            mlog << Error << "\nwrite_nc_block() -> "
+                 << "error writing NetCDF variable " << it->first
+                 << ".\n\n";
+            exit(1);
+         }
+      }
+
+      // Reset the values for the next block
+      for(k=0; k<conf_info.block_size; k++) it->second.buf[k] = bad_data_float;
    }
 
    return;
@@ -2173,6 +2494,7 @@ void clean_up() {
    map<ConcatString, NcVarData>::const_iterator it;
    for(it=stat_data.begin(); it!=stat_data.end(); it++) {
       if(it->second.var) { delete it->second.var; }
+      if(it->second.buf) { delete [] it->second.buf; }
    }
 
    // Close the output NetCDF file
@@ -2181,6 +2503,7 @@ void clean_up() {
       // List the NetCDF file after it is finished
       mlog << Debug(1) << "Output file: " << out_file << "\n";
 
+      PerfTimer timer("write_output");
       delete nc_out;
       nc_out = (NcFile *) 0;
    }
@@ -96,11 +96,15 @@ static NcDim  lon_dim ;
 // Structure to store computed statistics and corresponding metadata
 struct NcVarData {
    NcVar * var; // Pointer to NetCDF variable
+   float * buf; // Statistic value for each point in the current block
 };
 
 // Mapping of NetCDF variable name to computed statistic
 map<ConcatString, NcVarData> stat_data;
 
+// Grid points of the current block, in increasing order
+static vector<int> stat_block_pnt;
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Miscellaneous Variables
@@ -133,6 +137,13 @@ static SeriesType series_type = SeriesType_None;
 // Series length
 static int n_series = 0;
 
+// Types of statistics computed for each point
+static bool cts_flag   = false;
+static bool mcts_flag  = false;
+static bool cnt_flag   = false;
+static bool sl1l2_flag = false;
+static bool pct_flag   = false;
+
 // Range of timing values encountered in the data
 static unixtime fcst_init_beg  = (unixtime) 0;
 static unixtime fcst_init_end  = (unixtime) 0;
@@ -80,6 +80,8 @@ void SeriesAnalysisConfInfo::clear() {
    mask_poly_name.clear();
    mask_area.clear();
    block_size = bad_data_int;
+   single_pass_flag = false;
+   single_pass_max_mb = bad_data_int;
    vld_data_thresh = bad_data_double;
    rank_corr_flag = false;
    tmp_dir.clear();
@@ -136,6 +138,7 @@ void SeriesAnalysisConfInfo::process_config(GrdFileType ftype,
    VarInfoFactory info_factory;
    Dictionary *fdict = (Dictionary *) 0;
    Dictionary *odict = (Dictionary *) 0;
+   Dictionary *d     = (Dictionary *) 0;
    Dictionary i_fdict, i_odict;
    BootInfo boot_info;
    map<STATLineType,StringArray>::iterator it;
@@ -346,6 +349,19 @@ void SeriesAnalysisConfInfo::process_config(GrdFileType ftype,
       exit(1);
    }
 
+   // Conf: single_pass
+   d = conf.lookup_dictionary(conf_key_single_pass);
+   single_pass_flag   = d->lookup_bool(conf_key_flag);
+   single_pass_max_mb = d->lookup_int(conf_key_max_mem_mb);
+
+   if(single_pass_max_mb <= 0) {
+      mlog << Error << "\nSeriesAnalysisConfInfo::process_config() -> "
+           << "The \"" << conf_key_single_pass << "." << conf_key_max_mem_mb
+           << "\" parameter (" << single_pass_max_mb
+           << ") must be greater than 0.\n\n";
+      exit(1);
+   }
+
    // Conf: vld_thresh
    vld_data_thresh = conf.lookup_double(conf_key_vld_thresh);
 
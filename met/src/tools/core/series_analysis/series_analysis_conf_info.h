@@ -71,6 +71,8 @@ class SeriesAnalysisConfInfo {
       MaskPlane        mask_area;
 
       int              block_size;         // Number of grid points to read concurrently
+      bool             single_pass_flag;   // Flag for reading each input file once
+      int              single_pass_max_mb; // Maximum in-memory series size (MB)
       double           vld_data_thresh;    // Minimum valid data ratio for each point
       bool             rank_corr_flag;     // Flag for computing rank correlations
 
@@ -0,0 +1,152 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+#include <cstdlib>
+#include <iostream>
+#include <string.h>
+
+#include "series_data_cube.h"
+
+#include "vx_log.h"
+
+////////////////////////////////////////////////////////////////////////
+//
+//  Code for class SeriesDataCube
+//
+////////////////////////////////////////////////////////////////////////
+
+SeriesDataCube::SeriesDataCube() {
+
+   init_from_scratch();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+SeriesDataCube::~SeriesDataCube() {
+
+   clear();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+SeriesDataCube::SeriesDataCube(const SeriesDataCube &c) {
+
+   init_from_scratch();
+
+   assign(c);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+SeriesDataCube & SeriesDataCube::operator=(const SeriesDataCube &c) {
+
+   if(this == &c) return(*this);
+
+   assign(c);
+
+   return(*this);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void SeriesDataCube::init_from_scratch() {
+
+   clear();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void SeriesDataCube::assign(const SeriesDataCube &c) {
+
+   clear();
+
+   NPoints = c.NPoints;
+   NSeries = c.NSeries;
+   Buf     = c.Buf;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void SeriesDataCube::clear() {
+
+   NPoints = NSeries = 0;
+
+   Buf.clear();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void SeriesDataCube::set_size(int n_points, int n_series,
+                              bigint max_bytes, const char *tmp_dir) {
+   bigint n, n_bytes;
+   float *f = (float *) 0;
+
+   clear();
+
+   if(n_points <= 0 || n_series <= 0) {
+      mlog << Error << "\nSeriesDataCube::set_size() -> "
+           << "bad size (" << n_points << ", " << n_series << ")\n\n";
+      exit(1);
+   }
+
+   NPoints = n_points;
+   NSeries = n_series;
+
+   n       = (bigint) NPoints * NSeries * n_series_field;
+   n_bytes = n * (bigint) sizeof(float);
+
+   // Use heap memory or a memory-mapped scratch file
+   if(n_bytes <= max_bytes) Buf.allocate(n_bytes);
+   else                     Buf.allocate(n_bytes, tmp_dir);
+
+   // Initialize to bad data
+   f = (float *) Buf.buf();
+   for(bigint i=0; i<n; i++) f[i] = bad_data_float;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+float * SeriesDataCube::plane(int i_series, SeriesField k) {
+
+   if(i_series < 0 || i_series >= NSeries) {
+      mlog << Error << "\nSeriesDataCube::plane() -> "
+           << "range check error for series index " << i_series << "\n\n";
+      exit(1);
+   }
+
+   return((float *) Buf.buf() +
+          ((bigint) i_series * n_series_field + k) * NPoints);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+const float * SeriesDataCube::plane(int i_series, SeriesField k) const {
+
+   if(i_series < 0 || i_series >= NSeries) {
+      mlog << Error << "\nSeriesDataCube::plane() -> "
+           << "range check error for series index " << i_series << "\n\n";
+      exit(1);
+   }
+
+   return((const float *) Buf.buf() +
+          ((bigint) i_series * n_series_field + k) * NPoints);
+}
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,109 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2021
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+////////////////////////////////////////////////////////////////////////
+//
+//   Filename:   series_data_cube.h
+//
+//   Description:
+//      Compact single precision storage for the forecast, observation,
+//      and climatology time series at each masked grid point, so that
+//      each input file need only be read once.
+//
+////////////////////////////////////////////////////////////////////////
+
+#ifndef  __SERIES_DATA_CUBE_H__
+#define  __SERIES_DATA_CUBE_H__
+
+////////////////////////////////////////////////////////////////////////
+
+#include "vx_util.h"
+
+////////////////////////////////////////////////////////////////////////
+
+//
+// Fields stored for each series entry
+//
+
+enum SeriesField {
+   SeriesField_Fcst  = 0,
+   SeriesField_Obs   = 1,
+   SeriesField_Cmn   = 2,
+   SeriesField_Csd   = 3
+};
+
+static const int n_series_field = 4;
+
+////////////////////////////////////////////////////////////////////////
+
+class SeriesDataCube {
+
+   private:
+
+      void init_from_scratch();
+
+      void assign(const SeriesDataCube &);
+
+      int NPoints;   //  number of masked grid points
+      int NSeries;   //  length of the series
+
+         //
+         //  For each series entry, one plane of NPoints values for
+         //  each SeriesField, so that each entry is written
+         //  contiguously as it is read
+         //
+
+      MappedBuffer Buf;
+
+   public:
+
+      SeriesDataCube();
+     ~SeriesDataCube();
+      SeriesDataCube(const SeriesDataCube &);
+      SeriesDataCube & operator=(const SeriesDataCube &);
+
+      void clear();
+
+         //
+         //  set stuff
+         //
+
+         //  Store the cube on the heap when it fits within max_bytes
+         //  and in a memory-mapped scratch file in tmp_dir otherwise
+
+      void set_size(int n_points, int n_series,
+                    bigint max_bytes, const char *tmp_dir);
+
+         //
+         //  get stuff
+         //
+
+      int n_points() const;
+      int n_series() const;
+
+      bigint n_bytes() const;
+      bool   is_mapped() const;
+
+      float * plane(int i_series, SeriesField);
+      const float * plane(int i_series, SeriesField) const;
+
+};
+
+////////////////////////////////////////////////////////////////////////
+
+inline int SeriesDataCube::n_points() const { return(NPoints); }
+inline int SeriesDataCube::n_series() const { return(NSeries); }
+
+inline bigint SeriesDataCube::n_bytes()   const { return(Buf.n_bytes());   }
+inline bool   SeriesDataCube::is_mapped() const { return(Buf.is_mapped()); }
+
+////////////////////////////////////////////////////////////////////////
+
+#endif   //  __SERIES_DATA_CUBE_H__
+
+////////////////////////////////////////////////////////////////////////
@@ -49,6 +49,7 @@ using namespace std;
 #include <cstdio>
 #include <dirent.h>
 #include <iostream>
+#include <sstream>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/types.h>
@@ -89,15 +90,19 @@ static void usage();
 static void set_lookin_path(const StringArray &);
 static void set_out_filename(const StringArray &);
 static void set_tmp_dir(const StringArray &);
+static void set_index_dir(const StringArray &);
 static void set_config_file(const StringArray &);
 static void process_search_dirs();
 static void process_stat_file(const char *, const STATAnalysisJob &, int &, int &);
+static void process_stat_file_indexed(const char *, const STATAnalysisJob &, int &, int &);
 
 #ifdef WITH_PYTHON
 static void process_python(const STATAnalysisJob &);
 #endif
 
+static void setup_job(const char *, int, STATAnalysisJob &);
 static void process_job(const char *, int);
+static void process_jobs_parallel(const StringArray &);
 static void clean_up();
 
 //
@@ -122,11 +127,21 @@ int main(int argc, char * argv []) {
    //
    set_new_handler(oom);
 
+   //
+   // Enable profiling, if requested
+   //
+   mperf.init(program_name);
+
    //
    // Parse the command line
    //
    parse_command_line(argc, argv);
 
+   //
+   // Initialize OpenMP
+   //
+   init_openmp();
+
    //
    // Read config file constants and the default config file.
    //
@@ -205,8 +220,14 @@ int main(int argc, char * argv []) {
 
          jobs_sa = conf.lookup_string_array(conf_key_jobs);
 
-         for(i=0; i<jobs_sa.n_elements(); i++) {
-            process_job(jobs_sa[i].c_str(), i+1);
+         if(conf.lookup_bool(conf_key_parallel_jobs) &&
+            jobs_sa.n_elements() > 1) {
+            process_jobs_parallel(jobs_sa);
+         }
+         else {
+            for(i=0; i<jobs_sa.n_elements(); i++) {
+               process_job(jobs_sa[i].c_str(), i+1);
+            }
          }
       }
       //
@@ -274,6 +295,7 @@ void parse_command_line(int &argc, char **argv) {
    cline.add(set_lookin_path, "-lookin", -1);
    cline.add(set_out_filename, "-out", 1);
    cline.add(set_tmp_dir, "-tmp_dir", 1);
+   cline.add(set_index_dir, "-index_dir", 1);
    cline.add(set_config_file, "-config", 1);
 
    //
@@ -435,6 +457,7 @@ void process_search_dirs() {
    int n, i, j, max_len, n_read, n_keep;
    MetConfig go_conf;
    STATAnalysisJob go_job;
+   PerfTimer timer("search_dirs");
 
    //
    // Initialize
@@ -516,12 +539,20 @@ void process_search_dirs() {
 
       }
 
-      process_stat_file(files[i].c_str(), default_job, n_read, n_keep);
+      if(index_dir.nonempty()) {
+         process_stat_file_indexed(files[i].c_str(), default_job, n_read, n_keep);
+      }
+      else {
+         process_stat_file(files[i].c_str(), default_job, n_read, n_keep);
+      }
    }
 
    mlog << Debug(2) << "STAT Lines read     = " << n_read << "\n";
    mlog << Debug(2) << "STAT Lines retained = " << n_keep << "\n";
 
+   mperf.add_count("stat_lines_read", n_read);
+   mperf.add_count("stat_lines_retained", n_keep);
+
    tmp_out.close();
 
    return;
@@ -568,6 +599,99 @@ void process_stat_file(const char *filename, const STATAnalysisJob &job, int &n_
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Use the index of the header columns, stored in the -index_dir
+// directory, to parse only the lines which may satisfy the filtering
+// criteria.  The index is rebuilt when missing or out of date.
+//
+////////////////////////////////////////////////////////////////////////
+
+void process_stat_file_indexed(const char *filename, const STATAnalysisJob &job, int &n_read, int &n_keep) {
+   int i, prev_row;
+   STATLine line;
+   LineDataFile f;
+   STATIndex idx;
+   ConcatString idx_file;
+   vector<int> rows;
+
+   //
+   // Read the existing index or build and write a new one
+   //
+   idx_file = stat_index_filename(index_dir.c_str(), filename);
+
+   if(!idx.read(idx_file.c_str(), filename)) {
+
+      mlog << Debug(3) << "Building STAT file index \""
+           << idx_file << "\".\n";
+
+      if(!idx.build(filename)) throw(1);
+
+      idx.write(idx_file.c_str());
+   }
+
+   //
+   // Count the data lines and select the candidates
+   //
+   for(i=0; i<idx.n_lines(); i++) {
+      if(!idx.is_header(i)) n_read++;
+   }
+
+   idx.select(job, rows);
+
+   mlog << Debug(4) << "Parsing " << (int) rows.size() << " of "
+        << idx.n_lines() << " indexed lines from STAT file \""
+        << filename << "\".\n";
+
+   if(rows.size() == 0) return;
+
+   if(!(f.open(filename))) {
+      mlog << Error << "\nprocess_stat_file_indexed() -> "
+           << "unable to open input stat file \""
+           << filename << "\"\n\n";
+
+      throw(1);
+   }
+
+   //
+   // Seek to each candidate line, unless it immediately follows the
+   // previous one
+   //
+   for(i=0,prev_row=-2; i<(int) rows.size(); i++) {
+
+      if(rows[i] != prev_row + 1) {
+         f.in->clear();
+         f.in->seekg(idx.offset(rows[i]));
+      }
+
+      prev_row = rows[i];
+
+      if(!(f >> line)) {
+         mlog << Error << "\nprocess_stat_file_indexed() -> "
+              << "unable to read line " << rows[i] + 1
+              << " of the index for STAT file \"" << filename
+              << "\".  Try removing the index file \"" << idx_file
+              << "\".\n\n";
+
+         throw(1);
+      }
+
+      //
+      // Pass header lines through to the output
+      //
+      if(line.is_header() || job.is_keeper(line)) {
+
+         if(!line.is_header()) n_keep++;
+
+         tmp_out << line;
+      }
+   } // end for i
+
+   f.close();
+
+   return;
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 #ifdef WITH_PYTHON
@@ -632,9 +756,8 @@ return;
 
 ////////////////////////////////////////////////////////////////////////
 
-void process_job(const char * jobstring, int n_job) {
-   STATAnalysisJob job, go_job;
-   ConcatString full_jobstring;
+void setup_job(const char * jobstring, int n_job, STATAnalysisJob &job) {
+   STATAnalysisJob go_job;
    MetConfig go_conf;
 
    mlog << Debug(4) << "process_job(jobstring): "
@@ -699,6 +822,18 @@ void process_job(const char * jobstring, int n_job) {
       job.parse_job_command(command_line_job_options.c_str());
    }
 
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void process_job(const char * jobstring, int n_job) {
+   STATAnalysisJob job;
+   ConcatString full_jobstring;
+   PerfTimer timer("job");
+
+   setup_job(jobstring, n_job, job);
+
    //
    // Get the full jobstring
    //
@@ -712,6 +847,111 @@ void process_job(const char * jobstring, int n_job) {
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Run the jobs concurrently, each reading the filtered STAT lines from
+// a shared in-memory copy of the temp file rather than parsing the
+// temp file again.  The output for each job is buffered and written in
+// job order.
+//
+////////////////////////////////////////////////////////////////////////
+
+void process_jobs_parallel(const StringArray &jobs_sa) {
+   int i, n_jobs;
+   bool run_serial = false;
+   StringArray out_files;
+   STATLineBuffer lines;
+   PerfTimer timer("parallel_jobs");
+
+   n_jobs = jobs_sa.n_elements();
+
+   vector<STATAnalysisJob> jobs(n_jobs);
+   vector<ConcatString>    full_jobstrings(n_jobs);
+   vector<string>          job_out(n_jobs);
+   vector<int>             job_error(n_jobs, 0);
+   vector<int>             job_status(n_jobs, 0);
+
+   //
+   // Setup all of the jobs before running any of them
+   //
+   for(i=0; i<n_jobs; i++) {
+      setup_job(jobs_sa[i].c_str(), i+1, jobs[i]);
+      full_jobstrings[i] = jobs[i].get_jobstring();
+   }
+
+   //
+   // Jobs which write to the same output file cannot be run concurrently
+   //
+   for(i=0; i<n_jobs; i++) {
+      if(jobs[i].dump_row) {
+         if(out_files.has(jobs[i].dump_row)) run_serial = true;
+         else                                out_files.add(jobs[i].dump_row);
+      }
+      if(jobs[i].stat_file) {
+         if(out_files.has(jobs[i].stat_file)) run_serial = true;
+         else                                 out_files.add(jobs[i].stat_file);
+      }
+   }
+
+   if(run_serial) {
+      mlog << Debug(2)
+           << "Running jobs serially since multiple jobs write to the "
+           << "same output file.\n";
+      for(i=0; i<n_jobs; i++) {
+         do_job(full_jobstrings[i], jobs[i], i+1, tmp_dir, tmp_path, sa_out);
+      }
+      return;
+   }
+
+   //
+   // Read the filtered STAT lines once
+   //
+   if(!lines.read(tmp_path.c_str())) {
+      mlog << Error << "\nprocess_jobs_parallel() -> "
+           << "can't open the temporary file \"" << tmp_path
+           << "\" for reading!\n\n";
+      throw(1);
+   }
+
+   mlog << Debug(2)
+        << "Running " << n_jobs << " jobs on " << met_num_threads()
+        << " thread(s).\n";
+
+#pragma omp parallel for schedule(dynamic)
+   for(i=0; i<n_jobs; i++) {
+      STATLineBufferFile f;
+      ostringstream out;
+
+      f.open(lines);
+
+      //
+      // Exceptions may not leave the parallel region
+      //
+      try {
+         do_job(full_jobstrings[i], f, jobs[i], i+1, tmp_dir, &out);
+      }
+      catch(int j) {
+         job_error[i]  = 1;
+         job_status[i] = j;
+      }
+
+      job_out[i] = out.str();
+   }
+
+   //
+   // Write the output in job order, stopping at the first failed job
+   //
+   for(i=0; i<n_jobs; i++) {
+
+      if(sa_out) *(sa_out) << job_out[i] << flush;
+      else       cout      << job_out[i] << flush;
+
+      if(job_error[i]) throw(job_status[i]);
+   }
+
+   return;
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 void clean_up() {
@@ -735,6 +975,7 @@ void usage() {
         << "\t-lookin path\n"
         << "\t[-out file]\n"
         << "\t[-tmp_dir path]\n"
+        << "\t[-index_dir path]\n"
         << "\t[-log file]\n"
         << "\t[-v level]\n"
         << "\t[-config config_file] | [JOB COMMAND LINE]\n\n"
@@ -750,6 +991,10 @@ void usage() {
         << "\t\t\"-tmp_dir path\" specifies the directory into which "
         << "temporary files should be written (optional).\n"
 
+        << "\t\t\"-index_dir path\" specifies a directory in which "
+        << "binary indices of the STAT file header columns are stored "
+        << "and reused to speed up the filtering of lines (optional).\n"
+
         << "\t\t\"-log file\" outputs log messages to the specified "
         << "file (optional).\n"
 
@@ -834,6 +1079,24 @@ void set_tmp_dir(const StringArray & a) {
 
 ////////////////////////////////////////////////////////////////////////
 
+void set_index_dir(const StringArray & a) {
+   index_dir = a[0];
+   DIR * dp = 0;
+
+   dp = met_opendir(index_dir.c_str());
+   if(!dp) {
+      mlog << Error << "\nparse_command_line() -> "
+           << "Cannot access the index_dir directory: "
+           << index_dir << "\n\n";
+      exit(1);
+   }
+   else {
+      met_closedir(dp);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////
+
 void set_config_file(const StringArray & a) {
    set_config(a[0].c_str());
 }
@@ -82,6 +82,9 @@ static ConcatString command_line_job_options;
 //
 ////////////////////////////////////////////////////////////////////////
 
+// Directory for STAT file indices set with -index_dir
+static ConcatString index_dir;
+
 // Default temporary path and file
 static ConcatString tmp_dir;
 static ConcatString tmp_file;
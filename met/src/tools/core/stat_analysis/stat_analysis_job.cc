@@ -139,10 +139,8 @@ void set_job_from_config(MetConfig &c, STATAnalysisJob &job) {
 
 void do_job(const ConcatString &jobstring, STATAnalysisJob &job,
             int n_job, const ConcatString &tmp_dir,
-            const ConcatString &tmp_path, ofstream *sa_out) {
+            const ConcatString &tmp_path, ostream *sa_out) {
    LineDataFile f;
-   int n_in, n_out;
-   gsl_rng *rng_ptr = (gsl_rng *) 0;
 
    //
    // Open up the temp file for reading the intermediate STAT line data
@@ -154,6 +152,24 @@ void do_job(const ConcatString &jobstring, STATAnalysisJob &job,
       throw(1);
    }
 
+   do_job(jobstring, f, job, n_job, tmp_dir, sa_out);
+
+   //
+   // Close the input file stream
+   //
+   f.close();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void do_job(const ConcatString &jobstring, LineDataFile &f,
+            STATAnalysisJob &job, int n_job,
+            const ConcatString &tmp_dir, ostream *sa_out) {
+   int n_in, n_out;
+   gsl_rng *rng_ptr = (gsl_rng *) 0;
+
    //
    // Initialize n_in and n_out to keep track of the number of lines
    // read and retained.
@@ -254,11 +270,6 @@ void do_job(const ConcatString &jobstring, STATAnalysisJob &job,
    //
    if(job.stat_out) job.close_stat_file();
 
-   //
-   // Close the input file stream
-   //
-   f.close();
-
    //
    // Deallocate memory for the random number generator
    //
@@ -276,7 +287,7 @@ void do_job(const ConcatString &jobstring, STATAnalysisJob &job,
 
 void do_job_filter(const ConcatString &jobstring, LineDataFile &f,
                    STATAnalysisJob &job, int &n_in, int &n_out,
-                   ofstream *sa_out) {
+                   ostream *sa_out) {
    ConcatString out_line;
    STATLine line;
 
@@ -334,7 +345,7 @@ void do_job_filter(const ConcatString &jobstring, LineDataFile &f,
 
 void do_job_summary(const ConcatString &jobstring, LineDataFile &f,
                     STATAnalysisJob &job, int &n_in, int &n_out,
-                    ofstream *sa_out, gsl_rng *rng_ptr) {
+                    ostream *sa_out, gsl_rng *rng_ptr) {
    map<ConcatString, AggrSummaryInfo> summary_map;
    AsciiTable out_at;
 
@@ -392,7 +403,7 @@ void do_job_summary(const ConcatString &jobstring, LineDataFile &f,
 
 void do_job_aggr(const ConcatString &jobstring, LineDataFile &f,
                  STATAnalysisJob &job, int &n_in, int &n_out,
-                 ofstream *sa_out) {
+                 ostream *sa_out) {
    STATLine line;
    STATLineType lt;
    AsciiTable out_at;
@@ -585,7 +596,7 @@ void do_job_aggr(const ConcatString &jobstring, LineDataFile &f,
 
 void do_job_aggr_stat(const ConcatString &jobstring, LineDataFile &f,
                       STATAnalysisJob &job, int &n_in, int &n_out,
-                      ofstream *sa_out, const ConcatString &tmp_dir,
+                      ostream *sa_out, const ConcatString &tmp_dir,
                       gsl_rng *rng_ptr) {
    STATLine line;
    STATLineType in_lt;
@@ -3950,7 +3961,7 @@ void write_job_ramp_cols(const STATAnalysisJob &job, AsciiTable &at,
 
 void do_job_go_index(const ConcatString &jobstring, LineDataFile &f,
                      STATAnalysisJob &job, int &n_in, int &n_out,
-                     ofstream *sa_out) {
+                     ostream *sa_out) {
    double go_index;
    AsciiTable out_at;
 
@@ -4011,7 +4022,7 @@ void do_job_go_index(const ConcatString &jobstring, LineDataFile &f,
 
 void do_job_ss_index(const ConcatString &jobstring, LineDataFile &f,
                      STATAnalysisJob &job, int &n_in, int &n_out,
-                     ofstream *sa_out) {
+                     ostream *sa_out) {
    double ss_index;
    AsciiTable out_at;
 
@@ -4064,7 +4075,7 @@ void do_job_ss_index(const ConcatString &jobstring, LineDataFile &f,
 
 void do_job_ramp(const ConcatString &jobstring, LineDataFile &f,
                  STATAnalysisJob &job, int &n_in, int &n_out,
-                 ofstream *sa_out) {
+                 ostream *sa_out) {
    STATLine line;
    AsciiTable ctc_at, cts_at, mpr_at;
 
@@ -4204,7 +4215,7 @@ void setup_table(AsciiTable &at, int n_hdr_cols, int prec) {
 
 ////////////////////////////////////////////////////////////////////////
 
-void write_table(AsciiTable &at, ofstream *sa_out) {
+void write_table(AsciiTable &at, ostream *sa_out) {
 
    //
    // Do not write an empty table
@@ -4219,7 +4230,7 @@ void write_table(AsciiTable &at, ofstream *sa_out) {
 
 ////////////////////////////////////////////////////////////////////////
 
-void write_jobstring(const ConcatString &jobstring, ofstream *sa_out) {
+void write_jobstring(const ConcatString &jobstring, ostream *sa_out) {
    ConcatString out_line;
 
    out_line << "JOB_LIST:      " << jobstring;
@@ -4231,7 +4242,7 @@ void write_jobstring(const ConcatString &jobstring, ofstream *sa_out) {
 
 ////////////////////////////////////////////////////////////////////////
 
-void write_line(const ConcatString &str, ofstream *sa_out) {
+void write_line(const ConcatString &str, ostream *sa_out) {
 
    if(sa_out) *(sa_out) << str << "\n" << flush;
    else       cout      << str << "\n" << flush;
@@ -53,29 +53,33 @@ extern void set_job_from_config(MetConfig &, STATAnalysisJob &);
 
 extern void do_job(const ConcatString &, STATAnalysisJob &, int,
                const ConcatString &, const ConcatString &,
-               ofstream *);
+               ostream *);
+
+extern void do_job(const ConcatString &, LineDataFile &,
+               STATAnalysisJob &, int, const ConcatString &,
+               ostream *);
 
 extern void do_job_filter(const ConcatString &, LineDataFile &,
-               STATAnalysisJob &, int &, int &, ofstream *);
+               STATAnalysisJob &, int &, int &, ostream *);
 
 extern void do_job_summary(const ConcatString &, LineDataFile &,
-               STATAnalysisJob &, int &, int &, ofstream *, gsl_rng *);
+               STATAnalysisJob &, int &, int &, ostream *, gsl_rng *);
 
 extern void do_job_aggr(const ConcatString &, LineDataFile &,
-               STATAnalysisJob &, int &, int &, ofstream *);
+               STATAnalysisJob &, int &, int &, ostream *);
 
 extern void do_job_aggr_stat(const ConcatString &, LineDataFile &,
-               STATAnalysisJob &, int &, int &, ofstream *,
+               STATAnalysisJob &, int &, int &, ostream *,
                const ConcatString &, gsl_rng *);
 
 extern void do_job_go_index(const ConcatString &, LineDataFile &,
-               STATAnalysisJob &, int &, int &, ofstream *);
+               STATAnalysisJob &, int &, int &, ostream *);
 
 extern void do_job_ss_index(const ConcatString &, LineDataFile &,
-               STATAnalysisJob &, int &, int &, ofstream *);
+               STATAnalysisJob &, int &, int &, ostream *);
 
 extern void do_job_ramp(const ConcatString &, LineDataFile &,
-               STATAnalysisJob &, int &, int &, ofstream *);
+               STATAnalysisJob &, int &, int &, ostream *);
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -146,9 +150,9 @@ extern void write_job_ramp_cols(const STATAnalysisJob &, AsciiTable &,
 ////////////////////////////////////////////////////////////////////////
 
 extern void setup_table    (AsciiTable &, int, int);
-extern void write_table    (AsciiTable &,  ofstream *);
-extern void write_jobstring(const ConcatString &, ofstream *);
-extern void write_line     (const ConcatString &, ofstream *);
+extern void write_table    (AsciiTable &,  ostream *);
+extern void write_jobstring(const ConcatString &, ostream *);
+extern void write_line     (const ConcatString &, ostream *);
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -141,6 +141,9 @@ int main(int argc, char *argv[]) {
    // Process the command line arguments
    process_command_line(argc, argv);
 
+   // Initialize OpenMP
+   init_openmp();
+
    // Compute the scores and write them out
    process_scores();
 
@@ -29,6 +29,7 @@
 
 using namespace std;
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
@@ -67,9 +68,18 @@ int main(int argc, char *argv[]) {
    // Process the command line arguments
    process_command_line(argc, argv);
 
+   // Initialize OpenMP
+   init_openmp();
+
    // Process the input grid
    process_input_grid(dp_data);
 
+   // Write masks for all of the shapes in a single pass
+   if(mask_type == MaskType_Shape && shape_all) {
+      process_shape_batch(dp_data);
+      return(0);
+   }
+
    // Process the mask file
    process_mask_file(dp_mask);
 
@@ -124,6 +134,7 @@ void process_command_line(int argc, char **argv) {
    cline.add(set_name,         "-name",         1);
    cline.add(set_compress,     "-compress",     1);
    cline.add(set_shapeno,      "-shapeno",      1);
+   cline.add(set_shape_label,  "-shape_label",  0);
 
    cline.allow_numbers();
 
@@ -138,6 +149,28 @@ void process_command_line(int argc, char **argv) {
    mask_filename  = cline[1];
    out_filename   = cline[2];
 
+   // Check the shapefile batch options
+   if(shape_all && mask_type != MaskType_Shape) {
+      mlog << Error << "\nprocess_command_line() -> "
+           << "\"-shapeno all\" is only supported for \"shape\" "
+           << "masking.\n\n";
+      exit(1);
+   }
+
+   if(shape_label && !shape_all) {
+      mlog << Error << "\nprocess_command_line() -> "
+           << "\"-shape_label\" requires \"-shapeno all\".\n\n";
+      exit(1);
+   }
+
+   if(shape_label && (complement || set_logic != SetLogic_None)) {
+      mlog << Error << "\nprocess_command_line() -> "
+           << "\"-shape_label\" cannot be combined with the "
+           << "\"-complement\", \"-union\", \"-intersection\", or "
+           << "\"-symdiff\" options.\n\n";
+      exit(1);
+   }
+
    // List the input files
    mlog << Debug(1)
         << "Input Grid:\t\t" << input_gridname << "\n"
@@ -388,6 +421,105 @@ void process_mask_file(DataPlane &dp) {
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Write masks for all of the shapes in the shapefile, reading it and
+// setting up the output file only once.  By default, each shape is
+// combined with the input field and written to its own variable.  For
+// labeled output, a single variable contains the number of the first
+// shape which includes each grid point.
+//
+////////////////////////////////////////////////////////////////////////
+
+void process_shape_batch(const DataPlane &dp_data) {
+   int i, x, y, n_in;
+   int x_ll, y_ll, nx, ny;
+   vector<ShpPolyRecord> shapes;
+   vector<char> inside;
+   DataPlane dp_mask, dp_out;
+   NcFile *f_out = (NcFile *) 0;
+   NcDim lat_dim;
+   NcDim lon_dim;
+   vector<NcVar> mask_vars;
+   ConcatString cs;
+
+   // Read all of the shapes
+   get_shapefile_records(shapes);
+
+   mlog << Debug(2)
+        << "Parsed Shape Mask:\t" << mask_filename
+        << " containing " << shapes.size() << " shapes\n";
+
+   // Set the mask_name, if not already set
+   if(mask_name.length() == 0) {
+      mask_name << masktype_to_string(mask_type) << "_mask";
+   }
+
+   // Create a new NetCDF file and open it.
+   f_out = open_netcdf(lat_dim, lon_dim);
+
+   // Store the shape number for each grid point
+   if(shape_label) {
+
+      dp_out.set_size(grid.nx(), grid.ny());
+      dp_out.set_constant(bad_data_double);
+
+      for(i=0, n_in=0; i<(int) shapes.size(); i++) {
+
+         get_shape_mask(shapes[i], x_ll, y_ll, nx, ny, inside);
+
+         // Only update points within the bounding box
+         for(y=0; y<ny; y++) {
+            for(x=0; x<nx; x++) {
+               if(!inside[y*nx + x] ||
+                  !is_bad_data(dp_out(x_ll + x, y_ll + y))) continue;
+               dp_out.set(i, x_ll + x, y_ll + y);
+               n_in++;
+            }
+         }
+      } // for i
+
+      mlog << Debug(3)
+           << "Shape Masking:\t\t" << n_in << " of "
+           << grid.nx() * grid.ny() << " points inside "
+           << shapes.size() << " shapes\n";
+
+      cs << cs_erase << mask_name << " shape number";
+      mask_vars.push_back(add_mask_var(f_out, lat_dim, lon_dim,
+                                       mask_name, cs, dp_data));
+      put_mask_data(mask_vars[0], dp_out);
+   }
+   // Write a separate mask for each shape
+   else {
+
+      for(i=0; i<(int) shapes.size(); i++) {
+         ConcatString var_name;
+         var_name << mask_name << "_" << i;
+         cs << cs_erase << var_name << " masking region";
+         mask_vars.push_back(add_mask_var(f_out, lat_dim, lon_dim,
+                                          var_name, cs, dp_data));
+      } // for i
+
+      dp_mask.set_size(grid.nx(), grid.ny());
+
+      for(i=0; i<(int) shapes.size(); i++) {
+
+         n_in = set_shape_mask(shapes[i], dp_mask);
+
+         mlog << Debug(3)
+              << "Shape Masking:\t\tShape " << i << ": " << n_in
+              << " of " << grid.nx() * grid.ny() << " points inside\n";
+
+         dp_out = combine(dp_data, dp_mask, set_logic);
+         put_mask_data(mask_vars[i], dp_out);
+      } // for i
+   }
+
+   close_netcdf(f_out);
+
+   return;
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 void get_data_plane(Met2dDataFile *mtddf_ptr,
@@ -470,25 +602,11 @@ bool get_gen_vx_mask_data(Met2dDataFile *mtddf_ptr, DataPlane &dp) {
 ////////////////////////////////////////////////////////////////////////
 
 void get_shapefile_outline(ShpPolyRecord & cur_shape) {
-   const char * const shape_filename = mask_filename.c_str();
    ShpFile f;
    ShpPolyRecord & pr = cur_shape;
 
    // Open shapefile
-   if(!(f.open(shape_filename))) {
-      mlog << Error << "\nget_shapefile_outline() -> "
-           << "unable to open shape file \"" << shape_filename
-           << "\"\n\n";
-      exit(1);
-   }
-
-   // Make sure it's a polygon file, and not some other type
-   if(f.shape_type() != shape_type_polygon) {
-      mlog << Error << "\nget_shapefile_outline() -> "
-           << "shape file \"" << shape_filename
-           << "\" is not a polygon file\n\n";
-      exit(1);
-   }
+   open_shapefile(f);
 
    // Skip through un-needed records
    for(int i=0; i<shape_number; i++) {
@@ -511,6 +629,56 @@ void get_shapefile_outline(ShpPolyRecord & cur_shape) {
 
 ////////////////////////////////////////////////////////////////////////
 
+void get_shapefile_records(vector<ShpPolyRecord> & shapes) {
+   ShpFile f;
+   ShpPolyRecord pr;
+
+   // Open shapefile
+   open_shapefile(f);
+
+   // Read all of the records
+   shapes.clear();
+   while(f >> pr) {
+      pr.toggle_longitudes();
+      shapes.push_back(pr);
+   }
+
+   if(shapes.size() == 0) {
+      mlog << Error << "\nget_shapefile_records() -> "
+           << "no records found in shape file \"" << mask_filename
+           << "\"\n\n";
+      exit(1);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void open_shapefile(ShpFile & f) {
+   const char * const shape_filename = mask_filename.c_str();
+
+   // Open shapefile
+   if(!(f.open(shape_filename))) {
+      mlog << Error << "\nopen_shapefile() -> "
+           << "unable to open shape file \"" << shape_filename
+           << "\"\n\n";
+      exit(1);
+   }
+
+   // Make sure it's a polygon file, and not some other type
+   if(f.shape_type() != shape_type_polygon) {
+      mlog << Error << "\nopen_shapefile() -> "
+           << "shape file \"" << shape_filename
+           << "\" is not a polygon file\n\n";
+      exit(1);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
 void apply_poly_mask(DataPlane & dp) {
    int x, y, n_in;
    bool inside;
@@ -518,9 +686,11 @@ void apply_poly_mask(DataPlane & dp) {
 
    n_in = 0;
 
-   // Check each grid point being inside the polyline
-   for(x=0; x<grid.nx(); x++) {
-      for(y=0; y<grid.ny(); y++) {
+   // Check each grid point being inside the polyline, one row per thread
+#pragma omp parallel for schedule(dynamic) private(x, inside, lat, lon) \
+                         reduction(+:n_in)
+   for(y=0; y<grid.ny(); y++) {
+      for(x=0; x<grid.nx(); x++) {
 
          // Lat/Lon value for the current grid point
          grid.xy_to_latlon(x, y, lat, lon);
@@ -537,8 +707,8 @@ void apply_poly_mask(DataPlane & dp) {
          // Store the current mask value
          dp.set( (inside ? 1.0 : 0.0), x, y);
 
-      } // end for y
-   } // end for x
+      } // end for x
+   } // end for y
 
    if(complement) {
       mlog << Debug(3)
@@ -632,7 +802,11 @@ void apply_box_mask(DataPlane &dp) {
 void apply_circle_mask(DataPlane &dp) {
    int x, y, i, n_in;
    double lat, lon, dist, v;
+   double pnt_lat, max_half_len;
    bool check;
+   vector< pair<double,int> > key;
+   vector<double> key_lat;
+   vector<int> key_id;
 
    // Check for no threshold
    if(thresh.get_type() == thresh_na) {
@@ -642,18 +816,33 @@ void apply_circle_mask(DataPlane &dp) {
            << "the minimum distance to the points will be written.\n\n";
    }
 
+   // Index the polyline points by latitude, falling back to checking
+   // every point when any latitude is missing
+   for(i=0, max_half_len=0.0; i<poly_mask.n_points(); i++) {
+      pnt_lat = poly_mask.lat(i);
+      if(!isfinite(pnt_lat)) {
+         max_half_len = 1.0E10;
+         pnt_lat = 0.0;
+      }
+      key.push_back(pair<double,int>(pnt_lat, i));
+   }
+   build_lat_index(key, key_lat, key_id);
+
    // For each grid point, compute mimumum distance to polyline points
-   for(x=0,n_in=0; x<grid.nx(); x++) {
-      for(y=0; y<grid.ny(); y++) {
+   n_in = 0;
+#pragma omp parallel for schedule(dynamic) \
+                         private(x, lat, lon, dist, v, check) \
+                         reduction(+:n_in)
+   for(y=0; y<grid.ny(); y++) {
+      for(x=0; x<grid.nx(); x++) {
 
          // Lat/Lon value for the current grid point
          grid.xy_to_latlon(x, y, lat, lon);
          lon -= 360.0*floor((lon + 180.0)/360.0);
 
          // Find the minimum distance to a polyline point
-         for(i=0, dist=1.0E10; i<poly_mask.n_points(); i++) {
-            dist = min(dist, gc_dist(lat, lon, poly_mask.lat(i), poly_mask.lon(i)));
-         }
+         dist = min_lat_index_dist(lat, lon, key_lat, key_id, max_half_len,
+                                   point_dist);
 
          // Apply threshold, if specified
          if(thresh.get_type() != thresh_na) {
@@ -673,8 +862,8 @@ void apply_circle_mask(DataPlane &dp) {
 
          // Store the result
          dp.set(v, x, y);
-      } // end for y
-   } // end for x
+      } // end for x
+   } // end for y
 
    if(thresh.get_type() != thresh_na && complement) {
       mlog << Debug(3)
@@ -704,7 +893,11 @@ void apply_circle_mask(DataPlane &dp) {
 void apply_track_mask(DataPlane &dp) {
    int x, y, i, n_in;
    double lat, lon, dist, v;
+   double half_len, max_half_len, mid_lat;
    bool check;
+   vector< pair<double,int> > key;
+   vector<double> key_lat;
+   vector<int> key_id;
 
    // Check for no threshold
    if(thresh.get_type() == thresh_na) {
@@ -714,21 +907,38 @@ void apply_track_mask(DataPlane &dp) {
            << "distance to the track will be written.\n\n";
    }
 
+   // Index the track segments by the latitude of their midpoints,
+   // falling back to checking every segment when any of them spans
+   // more than a quarter of a great circle
+   for(i=1, max_half_len=0.0; i<poly_mask.n_points(); i++) {
+      half_len = 0.5*gc_dist(poly_mask.lat(i-1), poly_mask.lon(i-1),
+                             poly_mask.lat(i),   poly_mask.lon(i));
+      mid_lat  = gc_mid_lat(poly_mask.lat(i-1), poly_mask.lon(i-1),
+                            poly_mask.lat(i),   poly_mask.lon(i));
+      if(!(half_len < 0.25*pi*earth_radius_km) || !isfinite(mid_lat)) {
+         max_half_len = 1.0E10;
+         mid_lat = 0.0;
+      }
+      max_half_len = max(max_half_len, half_len);
+      key.push_back(pair<double,int>(mid_lat, i));
+   }
+   build_lat_index(key, key_lat, key_id);
+
    // For each grid point, compute mimumum distance to track
-   for(x=0,n_in=0; x<grid.nx(); x++) {
-      for(y=0; y<grid.ny(); y++) {
+   n_in = 0;
+#pragma omp parallel for schedule(dynamic) \
+                         private(x, lat, lon, dist, v, check) \
+                         reduction(+:n_in)
+   for(y=0; y<grid.ny(); y++) {
+      for(x=0; x<grid.nx(); x++) {
 
          // Lat/Lon value for the current grid point
          grid.xy_to_latlon(x, y, lat, lon);
          lon -= 360.0*floor((lon + 180.0)/360.0);
 
          // Find the minimum distance to the track
-         for(i=1, dist=1.0E10; i<poly_mask.n_points(); i++) {
-            dist = min(dist,
-                       gc_dist_to_line(poly_mask.lat(i-1), poly_mask.lon(i-1),
-                                       poly_mask.lat(i),   poly_mask.lon(i),
-                                       lat, lon));
-         }
+         dist = min_lat_index_dist(lat, lon, key_lat, key_id, max_half_len,
+                                   segment_dist);
 
          // Apply threshold, if specified
          if(thresh.get_type() != thresh_na) {
@@ -748,8 +958,8 @@ void apply_track_mask(DataPlane &dp) {
 
          // Store the result
          dp.set(v, x, y);
-      } // end for y
-   } // end for x
+      } // end for x
+   } // end for y
 
    if(thresh.get_type() != thresh_na && complement) {
       mlog << Debug(3)
@@ -774,6 +984,96 @@ void apply_track_mask(DataPlane &dp) {
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// The great circle distance to any point is at least the distance
+// along the meridian, earth_radius_km times the latitude difference.
+// Points or segments are sorted by latitude and searched outward from
+// the latitude of the grid point until that bound, less the largest
+// segment half length, exceeds the minimum distance found so far.
+// This returns the same minimum as checking all of them.
+//
+////////////////////////////////////////////////////////////////////////
+
+void build_lat_index(vector< pair<double,int> > &key,
+                     vector<double> &key_lat, vector<int> &key_id) {
+   int i;
+
+   sort(key.begin(), key.end());
+
+   key_lat.resize(key.size());
+   key_id.resize(key.size());
+
+   for(i=0; i<(int) key.size(); i++) {
+      key_lat[i] = key[i].first;
+      key_id[i]  = key[i].second;
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+double min_lat_index_dist(double lat, double lon,
+                          const vector<double> &key_lat,
+                          const vector<int> &key_id,
+                          double max_half_len,
+                          double (*dist_fn)(int, double, double)) {
+   int i, lo, hi;
+   int n = (int) key_lat.size();
+   double dist = 1.0E10;
+
+   // Start with the entries on either side of the current latitude
+   hi = lower_bound(key_lat.begin(), key_lat.end(), lat) - key_lat.begin();
+   lo = hi - 1;
+
+   while(lo >= 0 || hi < n) {
+
+      // Take the closer of the two in latitude
+      if(hi >= n || (lo >= 0 && lat - key_lat[lo] <= key_lat[hi] - lat)) {
+         i = lo--;
+      }
+      else {
+         i = hi++;
+      }
+
+      // All remaining entries are at least this far away
+      if(earth_radius_km*rad_per_deg*fabs(lat - key_lat[i]) - max_half_len >
+         dist + dist_index_tol) break;
+
+      dist = min(dist, (*dist_fn)(key_id[i], lat, lon));
+   }
+
+   return(dist);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+double point_dist(int i, double lat, double lon) {
+   return(gc_dist(lat, lon, poly_mask.lat(i), poly_mask.lon(i)));
+}
+
+////////////////////////////////////////////////////////////////////////
+
+double segment_dist(int i, double lat, double lon) {
+   return(gc_dist_to_line(poly_mask.lat(i-1), poly_mask.lon(i-1),
+                          poly_mask.lat(i),   poly_mask.lon(i),
+                          lat, lon));
+}
+
+////////////////////////////////////////////////////////////////////////
+
+double gc_mid_lat(double lat1, double lon1, double lat2, double lon2) {
+   double x, y, z;
+
+   // Sum of the unit vectors points to the midpoint of the arc
+   x = cosd(lat1)*cosd(lon1) + cosd(lat2)*cosd(lon2);
+   y = cosd(lat1)*sind(lon1) + cosd(lat2)*sind(lon2);
+   z = sind(lat1) + sind(lat2);
+
+   return(atan2d(z, sqrt(x*x + y*y)));
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 void apply_grid_mask(DataPlane &dp) {
@@ -1023,71 +1323,255 @@ void apply_lat_lon_mask(DataPlane &dp) {
 ////////////////////////////////////////////////////////////////////////
 
 void apply_shape_mask(DataPlane & dp) {
+   int n_in;
+
+   // Check grid points
+   n_in = set_shape_mask(shape, dp);
+
+   if(complement) {
+      mlog << Debug(3)
+           << "Applying complement of the shapefile mask.\n";
+   }
+
+   // List number of points inside the mask
+   mlog << Debug(3)
+        << "Shape Masking:\t\t" << n_in << " of " << grid.nx() * grid.ny()
+        << " points inside\n";
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+int set_shape_mask(const ShpPolyRecord & cur_shape, DataPlane & dp) {
    int x, y, n_in;
+   int x_ll, y_ll, nx, ny;
+   bool status = false;
+   vector<char> inside;
+
+   // Only points in the bounding box of the shape need to be checked
+   get_shape_mask(cur_shape, x_ll, y_ll, nx, ny, inside);
+
+   for(y=0, n_in=0; y<(grid.ny()); y++) {
+      for(x=0; x<(grid.nx()); x++) {
+
+         status = (x >= x_ll && x < x_ll + nx &&
+                   y >= y_ll && y < y_ll + ny &&
+                   inside[(y - y_ll)*nx + (x - x_ll)] != 0);
+
+         // Check the complement
+         if(complement) status = !status;
+
+         if(status) n_in++;
+
+         dp.set( (status ? 1.0 : 0.0 ), x, y);
+      } // for x
+   } // for y
+
+   return(n_in);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Find the grid points inside of any part of the shape.  The points
+// checked are limited to the bounding box of the shape in grid units,
+// starting at (x_ll, y_ll) and nx by ny in size, and inside is set
+// for each of them in row-major order.
+//
+////////////////////////////////////////////////////////////////////////
+
+void get_shape_mask(const ShpPolyRecord & cur_shape,
+                    int & x_ll, int & y_ll, int & nx, int & ny,
+                    vector<char> & inside) {
+   int x, y, x_ur, y_ur;
    int j, k, n;
    int start, stop;
    double dx, dy, lat, lon;
-   bool status = false;
+   bool scan = true;
+   bool first = true;
    GridClosedPoly p;
    GridClosedPolyArray a;
+   vector< vector<int> > part_x, part_y;
 
    // Load up array
-   for(j=0; j<(shape.n_parts); j++) {
+   for(j=0; j<(cur_shape.n_parts); j++) {
 
       p.clear();
+      part_x.push_back(vector<int>());
+      part_y.push_back(vector<int>());
 
-      start = shape.start_index(j);
-      stop  = shape.stop_index(j);
+      start = cur_shape.start_index(j);
+      stop  = cur_shape.stop_index(j);
 
       n = stop - start + 1;
 
       for(k=0; k<n; ++k) {
 
-         lat = shape.lat(start + k);
-         lon = shape.lon(start + k);
+         lat = cur_shape.lat(start + k);
+         lon = cur_shape.lon(start + k);
 
          lon = -lon;   //  west is positive for us
 
          grid.latlon_to_xy(lat, lon, dx, dy);
 
+         // Edge crossings are only exact for reasonable vertices
+         if(!(fabs(dx) < max_scan_coord && fabs(dy) < max_scan_coord)) {
+            scan = false;
+         }
+
          x = nint(dx);
          y = nint(dy);
 
          p.add_point(x, y);
+         part_x[j].push_back(x);
+         part_y[j].push_back(y);
+
+         // Update the bounding box
+         if(first || x < x_ll) x_ll = x;
+         if(first || x > x_ur) x_ur = x;
+         if(first || y < y_ll) y_ll = y;
+         if(first || y > y_ur) y_ur = y;
+         first = false;
       } // for k
 
       a.add(p);
 
    } // for j
 
-   // Check grid points
-   for(x=0, n_in=0; x<(grid.nx()); x++) {
-      for (y=0; y<(grid.ny()); y++) {
+   // Clip the bounding box to the grid
+   if(!scan) {
+      x_ll = y_ll = 0;
+      x_ur = grid.nx() - 1;
+      y_ur = grid.ny() - 1;
+   }
+   else if(first) {
+      x_ll = y_ll = 0;
+      x_ur = y_ur = -1;
+   }
+   else {
+      x_ll = max(x_ll, 0);
+      y_ll = max(y_ll, 0);
+      x_ur = min(x_ur, grid.nx() - 1);
+      y_ur = min(y_ur, grid.ny() - 1);
+   }
 
-         status = a.is_inside(x, y);
+   nx = max(x_ur - x_ll + 1, 0);
+   ny = max(y_ur - y_ll + 1, 0);
 
-         // Check the complement
-         if(complement) status = !status;
+   inside.assign(nx*ny, 0);
 
-         if(status) n_in++;
+   // Scan the rows relative to the left edge of the bounding box
+   if(scan) {
+      for(j=0; j<(int) part_x.size(); j++) {
+         for(k=0; k<(int) part_x[j].size(); k++) part_x[j][k] -= x_ll;
+      }
+   }
 
-         dp.set( (status ? 1.0 : 0.0 ), x, y);
-      } // for y
-   } // for x
+   // Check grid points one row at a time.  The winding number of each
+   // part is accumulated from its edge crossings along the row and only
+   // points lying on an edge are checked against the polylines directly.
+#pragma omp parallel for schedule(dynamic) private(x, j)
+   for(y=0; y<ny; y++) {
 
-   if(complement) {
-      mlog << Debug(3)
-           << "Applying complement of the shapefile mask.\n";
-   }
+      vector<int> wind(nx + 1);
+      vector<char> on_edge(nx, 0), in_part(nx, 0);
 
-   // List number of points inside the mask
-   mlog << Debug(3)
-        << "Shape Masking:\t\t" << n_in << " of " << grid.nx() * grid.ny()
-        << " points inside\n";
+      if(scan) {
+         for(j=0; j<(int) part_x.size(); j++) {
+            scan_shape_row(part_x[j], part_y[j], y_ll + y, wind, on_edge);
+            for(x=1; x<nx; x++) wind[x] += wind[x-1];
+            for(x=0; x<nx; x++) if(wind[x] != 0) in_part[x] = 1;
+         }
+      }
+
+      for(x=0; x<nx; x++) {
+         if(scan && !on_edge[x]) inside[y*nx + x] = in_part[x];
+         else                    inside[y*nx + x] = a.is_inside(x_ll + x, y_ll + y);
+      } // for x
+   } // for y
+
+   return;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+//
+// Store the change in winding number of the closed polyline at each
+// x along grid row y in wind and flag the points lying on an edge.
+// With integer vertices, the cross product for point x of an edge
+// from (u0, v0) to (u1, v1) is exactly c0 - x*(v1 - v0).  Upward
+// edges wind counterclockwise around points to their left and
+// downward edges clockwise around points to their right.
+//
+////////////////////////////////////////////////////////////////////////
+
+void scan_shape_row(const vector<int> &u, const vector<int> &v, int y,
+                    vector<int> &wind, vector<char> &on_edge) {
+   int j, k, x, s;
+   int n  = (int) u.size();
+   int nx = (int) on_edge.size();
+   long long u0, v0, u1, v1, c0, x_max;
+
+   fill(wind.begin(), wind.end(), 0);
+
+   for(j=0; j<n; j++) {
+
+      k  = (j+1)%n;
+      u0 = u[j];
+      v0 = v[j];
+      u1 = u[k];
+      v1 = v[k];
+
+      // Horizontal edges never cross the row but may contain points
+      if(v0 == v1) {
+         if(v0 == y) {
+            for(x=max(0LL, min(u0, u1)); x<=min(nx-1LL, max(u0, u1)); x++) {
+               on_edge[x] = 1;
+            }
+         }
+         continue;
+      }
+
+      if(y < min(v0, v1) || y > max(v0, v1)) continue;
+
+      // Check for a grid point on the edge
+      if(((y - v0)*(u1 - u0)) % (v1 - v0) == 0) {
+         x_max = u0 + ((y - v0)*(u1 - u0))/(v1 - v0);
+         if(x_max >= 0 && x_max < nx) on_edge[x_max] = 1;
+      }
+
+      // Range of x for which the edge crosses the row
+      c0 = u0*(v1 - y) - (v0 - y)*u1;
+      if(v0 <= y && y < v1) {
+         x_max = floor_div(c0 - 1, v1 - v0);
+         s = 1;
+      }
+      else if(v1 <= y && y < v0) {
+         x_max = floor_div(-c0 - 1, v0 - v1);
+         s = -1;
+      }
+      else {
+         continue;
+      }
+
+      if(x_max < 0) continue;
+
+      wind[0] += s;
+      wind[min(x_max + 1, (long long) nx)] -= s;
+   }
 
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+
+long long floor_div(long long a, long long b) {
+   long long q = a/b;
+
+   if(a%b != 0 && ((a < 0) != (b < 0))) q--;
+
+   return(q);
+}
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -1173,20 +1657,49 @@ DataPlane combine(const DataPlane &dp_data, const DataPlane &dp_mask,
 ////////////////////////////////////////////////////////////////////////
 
 void write_netcdf(const DataPlane &dp) {
-   int n, x, y;
    ConcatString cs;
-
-   float *mask_data = (float *)  0;
-   NcFile *f_out    = (NcFile *) 0;
+   NcFile *f_out = (NcFile *) 0;
    NcDim lat_dim;
    NcDim lon_dim;
    NcVar mask_var;
 
+   // Create a new NetCDF file and open it.
+   f_out = open_netcdf(lat_dim, lon_dim);
+
+   // Set the mask_name, if not already set
+   if(mask_name.length() == 0) {
+      if(mask_type == MaskType_Poly   ||
+         mask_type == MaskType_Circle ||
+         mask_type == MaskType_Track) {
+         mask_name = poly_mask.name();
+      }
+      else {
+         mask_name << masktype_to_string(mask_type) << "_mask";
+      }
+   }
+
+   // Define Variables
+   cs << cs_erase << mask_name << " masking region";
+   mask_var = add_mask_var(f_out, lat_dim, lon_dim, mask_name, cs, dp);
+
+   // Write the mask values
+   put_mask_data(mask_var, dp);
+
+   close_netcdf(f_out);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+NcFile * open_netcdf(NcDim &lat_dim, NcDim &lon_dim) {
+   NcFile *f_out = (NcFile *) 0;
+
    // Create a new NetCDF file and open it.
    f_out = open_ncfile(out_filename.c_str(), true);
 
    if(IS_INVALID_NC_P(f_out)) {
-      mlog << Error << "\nwrite_netcdf() -> "
+      mlog << Error << "\nopen_netcdf() -> "
            << "trouble opening output file " << out_filename
            << "\n\n";
       delete f_out;
@@ -1207,25 +1720,24 @@ void write_netcdf(const DataPlane &dp) {
    // Add the lat/lon variables
    write_netcdf_latlon(f_out, &lat_dim, &lon_dim, grid);
 
-   // Set the mask_name, if not already set
-   if(mask_name.length() == 0) {
-      if(mask_type == MaskType_Poly   ||
-         mask_type == MaskType_Circle ||
-         mask_type == MaskType_Track) {
-         mask_name = poly_mask.name();
-      }
-      else {
-         mask_name << masktype_to_string(mask_type) << "_mask";
-      }
-   }
+   return(f_out);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+NcVar add_mask_var(NcFile *f_out, NcDim &lat_dim, NcDim &lon_dim,
+                   const ConcatString &var_name,
+                   const ConcatString &long_name,
+                   const DataPlane &dp) {
+   ConcatString cs;
+   NcVar mask_var;
 
    int deflate_level = compress_level;
    if (deflate_level < 0) deflate_level = config.nc_compression();
 
    // Define Variables
-   mask_var = add_var(f_out, string(mask_name), ncFloat, lat_dim, lon_dim, deflate_level);
-   cs << cs_erase << mask_name << " masking region";
-   add_att(&mask_var, "long_name", string(cs));
+   mask_var = add_var(f_out, string(var_name), ncFloat, lat_dim, lon_dim, deflate_level);
+   add_att(&mask_var, "long_name", string(long_name));
    add_att(&mask_var, "_FillValue", bad_data_float);
    cs << cs_erase << masktype_to_string(mask_type);
    if(thresh.get_type() != thresh_na) cs << thresh.get_str();
@@ -1243,6 +1755,15 @@ void write_netcdf(const DataPlane &dp) {
       write_netcdf_var_times(&mask_var, dp);
    }
 
+   return(mask_var);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void put_mask_data(NcVar &mask_var, const DataPlane &dp) {
+   int n, x, y;
+   float *mask_data = (float *) 0;
+
    // Allocate memory to store the mask values for each grid point
    mask_data = new float [grid.nx()*grid.ny()];
 
@@ -1255,7 +1776,7 @@ void write_netcdf(const DataPlane &dp) {
    } // end for x
 
    if(!put_nc_data_with_dims(&mask_var, &mask_data[0], grid.ny(), grid.nx())) {
-      mlog << Error << "\nwrite_netcdf() -> "
+      mlog << Error << "\nput_mask_data() -> "
            << "error with mask_var->put\n\n";
       // Delete allocated memory
       if(mask_data) { delete[] mask_data; mask_data = (float *) 0; }
@@ -1265,6 +1786,13 @@ void write_netcdf(const DataPlane &dp) {
    // Delete allocated memory
    if(mask_data) { delete[] mask_data; mask_data = (float *) 0; }
 
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void close_netcdf(NcFile *f_out) {
+
    delete f_out;
    f_out = (NcFile *) 0;
 
@@ -1348,7 +1876,8 @@ void usage() {
         << "\t[-thresh string]\n"
         << "\t[-height n]\n"
         << "\t[-width n]\n"
-        << "\t[-shapeno n]\n"
+        << "\t[-shapeno n | all]\n"
+        << "\t[-shape_label]\n"
         << "\t[-value n]\n"
         << "\t[-name string]\n"
         << "\t[-log file]\n"
@@ -1419,6 +1948,14 @@ void usage() {
         << "\t\t\"-shapeno n\" (optional).\n"
         << "\t\t   For \"shape\" masking, specify the shape number "
         << "(0-based) to be used.\n"
+        << "\t\t   Use \"all\" to write a separate mask variable, "
+        << "named with the shape number appended to \"-name\", for "
+        << "each shape in a single run.\n"
+
+        << "\t\t\"-shape_label\" (optional).\n"
+        << "\t\t   For \"-shapeno all\", write a single variable "
+        << "containing the number of the shape which includes each "
+        << "grid point instead.\n"
 
         << "\t\t\"-value n\" overrides the default output mask data "
         << "value (" << default_mask_val << ") (optional).\n"
@@ -1532,6 +2069,12 @@ void set_compress(const StringArray & a) {
 
 void set_shapeno(const StringArray & a) {
 
+   // Process all of the shapes
+   if(strcasecmp(a[0].c_str(), "all") == 0) {
+      shape_all = true;
+      return;
+   }
+
    shape_number = atoi(a[0].c_str());
 
    if(shape_number < 0) {
@@ -1544,3 +2087,9 @@ void set_shapeno(const StringArray & a) {
 }
 
 ////////////////////////////////////////////////////////////////////////
+
+void set_shape_label(const StringArray & a) {
+   shape_label = true;
+}
+
+////////////////////////////////////////////////////////////////////////
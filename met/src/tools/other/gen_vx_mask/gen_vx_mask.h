@@ -27,6 +27,12 @@
 
 using namespace std;
 
+#include <utility>
+#include <vector>
+
+#include <netcdf>
+using namespace netCDF;
+
 #include "vx_util.h"
 #include "vx_cal.h"
 #include "mask_poly.h"
@@ -78,6 +84,12 @@ extern const char * masktype_to_string(MaskType);
 static const MaskType default_mask_type = MaskType_Poly;
 static const double default_mask_val = 1.0;
 
+// Tolerance in km for pruning the latitude index searches
+static const double dist_index_tol = 1.0E-3;
+
+// Largest shapefile vertex grid coordinate for exact row scanning
+static const double max_scan_coord = 1.0E7;
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Variables for command line arguments
@@ -103,6 +115,8 @@ static unixtime solar_ut = (unixtime) 0;
 static ShpPolyRecord shape;
 
 static int shape_number = 0;
+static bool shape_all = false;
+static bool shape_label = false;
 
 // Masking polyline
 static MaskPoly poly_mask;
@@ -119,16 +133,35 @@ static int compress_level = -1;
 static void      process_command_line(int, char **);
 static void      process_input_grid(DataPlane &dp);
 static void      process_mask_file(DataPlane &dp);
+static void      process_shape_batch(const DataPlane &dp_data);
 static void      get_data_plane(Met2dDataFile *mtddf_ptr,
                                 const char *config_str, DataPlane &dp);
 static bool      get_gen_vx_mask_data(Met2dDataFile *mtddf_ptr,
                                       DataPlane &dp);
 static void      get_shapefile_outline(ShpPolyRecord &shape);
+static void      get_shapefile_records(vector<ShpPolyRecord> &shapes);
+static void      open_shapefile(ShpFile &f);
 static void      apply_poly_mask(DataPlane &dp);
 static void      apply_shape_mask(DataPlane &dp);
+static int       set_shape_mask(const ShpPolyRecord &, DataPlane &);
+static void      get_shape_mask(const ShpPolyRecord &,
+                                int &, int &, int &, int &,
+                                vector<char> &);
+static void      scan_shape_row(const vector<int> &, const vector<int> &,
+                                int, vector<int> &, vector<char> &);
+static long long floor_div(long long, long long);
 static void      apply_box_mask(DataPlane &dp);
 static void      apply_circle_mask(DataPlane &dp);
 static void      apply_track_mask(DataPlane &dp);
+static void      build_lat_index(vector< pair<double,int> > &,
+                                 vector<double> &, vector<int> &);
+static double    min_lat_index_dist(double, double,
+                                    const vector<double> &,
+                                    const vector<int> &, double,
+                                    double (*)(int, double, double));
+static double    point_dist(int, double, double);
+static double    segment_dist(int, double, double);
+static double    gc_mid_lat(double, double, double, double);
 static void      apply_grid_mask(DataPlane &dp);
 static void      apply_data_mask(DataPlane &dp);
 static void      apply_solar_mask(DataPlane &dp);
@@ -136,6 +169,12 @@ static void      apply_lat_lon_mask(DataPlane &dp);
 static DataPlane combine(const DataPlane &dp_data,
                          const DataPlane &dp_mask, SetLogic);
 static void      write_netcdf(const DataPlane &dp);
+static NcFile *  open_netcdf(NcDim &, NcDim &);
+static NcVar     add_mask_var(NcFile *, NcDim &, NcDim &,
+                              const ConcatString &, const ConcatString &,
+                              const DataPlane &);
+static void      put_mask_data(NcVar &, const DataPlane &);
+static void      close_netcdf(NcFile *);
 static void      usage();
 static void      set_type(const StringArray &);
 static void      set_input_field(const StringArray &);
@@ -151,6 +190,7 @@ static void      set_value(const StringArray &);
 static void      set_name(const StringArray &);
 static void      set_compress(const StringArray &);
 static void      set_shapeno(const StringArray &);
+static void      set_shape_label(const StringArray &);
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -223,20 +223,17 @@ MtdFloatFile MtdFloatFile::convolve(const int spatial_R, const int time_beg, con
 {
 
 int j, k, n;
-int x, y, t;
+int t;
 int n_good;
 double value;
 MtdFloatFile out;
 double min_conv_value, max_conv_value;
-double * conv_data = (double *) 0;
 DataHandle handle;
 unixtime time_start, time_stop;
 
 const int time_radius = time_end - time_beg + 1;
 
-double * p = 0;
-double * ss [time_radius];
-bool   * ok [time_radius];
+float * p = 0;
 
 const int trp1 = 2*spatial_R + 1;
 const double scale = 1.0/(trp1*trp1);
@@ -261,15 +258,13 @@ ok_sum_plane_buf = new bool   [Nxy];
 
 handle.set_size(Nx, Ny, time_radius);
 
-conv_data = new double [Nx*Ny*Nt];
-
-if ( !conv_data )  {
-
-   mlog << Error << "\n\n  MtdFloatFile::convolve(const int, const int, const int) const: process() -> memory allocation error\n\n";
-
-   exit ( 1 );
+   //
+   //  the convolved values are stored directly in the output file,
+   //  so only the planes in the time window are kept besides the
+   //  input and output
+   //
 
-}
+out.set_size(Nx, Ny, Nt);
 
    //
    //  get the min/max convolved data values
@@ -286,23 +281,21 @@ for (t=0; t<Nt; ++t)  {
 
    n = mtd_three_to_one(Nx, Ny, Nt, 0, 0, t);
 
-   p = conv_data + n;
+   p = out.Data + n;
 
    load_handle(handle, *this, t, time_beg, time_end);
 
    // handle.dump(cout);
 
-   for (k=0; k<time_radius; ++k)  {
-
-      ss[k] = handle.sum_plane[k];
-
-      ok[k] = handle.ok_sum_plane[k];
-
-   }
-
       // 
       //   the order of loops is important here
       // 
+      //   the points of the plane are independent, so split them
+      //   among the threads
+      // 
+
+#pragma omp parallel for schedule(static) private(k, n_good, value) \
+        reduction(min:min_conv_value) reduction(max:max_conv_value)
 
    for (j=0; j<Nxy; ++j)  {
 
@@ -316,7 +309,7 @@ for (t=0; t<Nt; ++t)  {
 
       for (k=0; k<time_radius; ++k)  {
 
-         if ( handle.plane_loaded[k] && *(ok[k]) )  ++n_good;
+         if ( handle.plane_loaded[k] && handle.ok_sum_plane[k][j] )  ++n_good;
 
       }
 
@@ -329,7 +322,7 @@ for (t=0; t<Nt; ++t)  {
 
          for (k=0; k<time_radius; ++k)  {
 
-            if ( handle.plane_loaded[k] && *(ok[k]) )  { value += (*ss[k]);  ++n_good; }
+            if ( handle.plane_loaded[k] && handle.ok_sum_plane[k][j] )  { value += handle.sum_plane[k][j];  ++n_good; }
 
          }
 
@@ -342,14 +335,7 @@ for (t=0; t<Nt; ++t)  {
 
       }
 
-      *p++ = value;
-
-      for (k=0; k<time_radius; ++k)  {
-
-         ++(ss[k]);
-         ++(ok[k]);
-
-      }   //  for k
+      p[j] = (float) value;
 
    }   //  for j
 
@@ -372,8 +358,6 @@ if ( verbose )  {
    //
 
 
-out.set_size(Nx, Ny, Nt);
-
 out.set_grid(*G);
 
 out.set_start_valid_time(StartValidTime);
@@ -395,39 +379,10 @@ for (j=0; j<Nt; ++j)  {
 }
 
 
-   //
-   //  calculate the data values
-   //
-
-
-for (x=0; x<Nx; ++x)  {
-
-   // if ( verbose && ((x%100) == 0) )  mlog << Debug(5) << "Pass 2: x = " << x << " of " << Nx << "\n";
-
-   for (y=0; y<Ny; ++y)  {
-
-      for (t=0; t<Nt; ++t)  {
-
-         n = mtd_three_to_one(Nx, Ny, Nt, x, y, t);
-
-         // value = calc_conv_value(in, x, y, t);
-         value = conv_data[n];
-
-         out.put((float) value, x, y, t);
-
-      }   //  for t
-
-   }   //  for y
-
-}   //  for x
-
-
    //
    //  done
    //
 
-if ( conv_data )  { delete [] conv_data;  conv_data = (double *) 0; }
-
 if (    sum_plane_buf )  { delete []    sum_plane_buf;     sum_plane_buf = 0; }
 if ( ok_sum_plane_buf )  { delete [] ok_sum_plane_buf;  ok_sum_plane_buf = 0; }
 
@@ -632,6 +587,16 @@ data_in_p  = data_plane;
 data_out_p =    sum_plane_buf;
   ok_out_p = ok_sum_plane_buf;
 
+   //
+   //  each row, and below each column, has its own moving sum,
+   //  so they're split among the threads
+   //
+
+#pragma omp parallel for schedule(static) \
+        private(x, n, moving_sum, bad_count, value, ok, \
+                value_front, value_back, ok_front, ok_back, \
+                data_back_p, ok_back_p, data_front_p, ok_front_p, \
+                data_put_p, ok_put_p)
 
 for (y=0; y<ny; ++y)  {
 
@@ -724,6 +689,12 @@ data_in_p =    sum_plane_buf;
 data_out_p =    sum_plane;
   ok_out_p = ok_sum_plane;
 
+#pragma omp parallel for schedule(static) \
+        private(y, n, moving_sum, bad_count, value, ok, \
+                value_front, value_back, ok_front, ok_back, \
+                data_back_p, ok_back_p, data_front_p, ok_front_p, \
+                data_put_p, ok_put_p)
+
 for (x=0; x<nx; ++x)  {
 
    moving_sum = 0.0;
@@ -823,15 +794,47 @@ void load_handle(DataHandle & handle, const MtdFloatFile & in, const int t, cons
 int j,  index, t_real;
 const int t_first = 0;
 const int t_last  = (in.nt() - 1);
-const int data_bytes = (in.nxy())*sizeof(double);
-const int   tf_bytes = (in.nxy())*sizeof(bool);
 const int nxy = in.nxy();
 const int time_radius = time_end - time_beg + 1;
 bool new_loaded[time_radius];
+bool shifted[time_radius];
+double * d_tmp = 0;
+double * s_tmp = 0;
+bool   * o_tmp = 0;
+bool   * k_tmp = 0;
 
 
 handle.t = t;
 
+   //
+   //  the window moves forward one time step, so the planes shift
+   //  down by one.  rotate the plane pointers rather than copying
+   //  the planes, so the first plane is reused for the new time.
+   //
+
+d_tmp = handle.data_plane   [0];
+s_tmp = handle.sum_plane    [0];
+o_tmp = handle.ok_plane     [0];
+k_tmp = handle.ok_sum_plane [0];
+
+for (index=0; index<(time_radius - 1); ++index)  {
+
+   handle.data_plane   [index] = handle.data_plane   [index + 1];
+   handle.sum_plane    [index] = handle.sum_plane    [index + 1];
+   handle.ok_plane     [index] = handle.ok_plane     [index + 1];
+   handle.ok_sum_plane [index] = handle.ok_sum_plane [index + 1];
+
+   shifted[index] = handle.plane_loaded[index + 1];
+
+}
+
+handle.data_plane   [time_radius - 1] = d_tmp;
+handle.sum_plane    [time_radius - 1] = s_tmp;
+handle.ok_plane     [time_radius - 1] = o_tmp;
+handle.ok_sum_plane [time_radius - 1] = k_tmp;
+
+shifted[time_radius - 1] = false;
+
 for (index=0; index<time_radius; ++index)  new_loaded[index] = false;
 
 for (index=0; index<time_radius; ++index)  handle.plane_time[index] = -1;
@@ -850,17 +853,7 @@ for (index=0; index<time_radius; ++index)  {
 
       //
 
-   if ( ((index + 1) < time_radius) && (handle.plane_loaded[index + 1]) )  {
-
-      memcpy(handle.data_plane   [index], handle.data_plane   [index + 1], data_bytes);
-      memcpy(handle.sum_plane    [index], handle.sum_plane    [index + 1], data_bytes);
-
-      memcpy(handle.ok_plane     [index], handle.ok_plane     [index + 1], tf_bytes);
-      memcpy(handle.ok_sum_plane [index], handle.ok_sum_plane [index + 1], tf_bytes);
-
-      continue;
-
-   }
+   if ( shifted[index] )  continue;
 
       //   nope
 
@@ -29,6 +29,7 @@ using namespace std;
 #include <ctime>
 #include <dirent.h>
 #include <iostream>
+#include <vector>
 
 #include "vx_log.h"
 #include "vx_data2d_factory.h"
@@ -112,6 +113,18 @@ static NcFile *nc_out  = (NcFile *) 0;
 static NcDim  lat_dim ;
 static NcDim  lon_dim ;
 
+////////////////////////////////////////////////////////////////////////
+//
+// Input points mapped to each cell of the target grid, stored in
+// compressed sparse row form.  The input indices for cell n are
+// Index[Offset[n]] through Index[Offset[n+1]-1], in ascending order.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct CellMapping {
+   vector<int> Offset;    // [n_cells + 1]
+   vector<int> Index;     // [n_mapped]
+};
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -140,15 +153,20 @@ static void set_gaussian_dx(const StringArray &);
 static void set_gaussian_radius(const StringArray &);
 
 static unixtime compute_unixtime(NcVar *time_var, unixtime var_value);
-static bool get_grid_mapping(Grid fr_grid, Grid to_grid, IntArray *cellMapping,
+static bool get_grid_mapping(Grid fr_grid, Grid to_grid, CellMapping &cellMapping,
                              NcVar var_lat, NcVar var_lon, bool *skip_times);
-static bool get_grid_mapping(Grid to_grid, IntArray *cellMapping,
-                             const IntArray obs_index_array, const int *obs_hids,
-                             const float *hdr_lats, const float *hdr_lons);
+static void get_hdr_cells(Grid to_grid, int nhdr, const float *hdr_lats,
+                          const float *hdr_lons, vector<int> &hdr_cells);
+static bool get_grid_mapping(Grid to_grid, CellMapping &cellMapping,
+                             const IntArray &obs_index_array, int nobs,
+                             const int *obs_hids, const vector<int> &hdr_cells);
+static void build_cell_mapping(CellMapping &cellMapping, int n_cells,
+                               const vector<int> &from_cells);
+static float compute_cell_value(NumArray &dataArray);
 static int  get_obs_type(NcFile *nc_in);
 static void regrid_nc_variable(NcFile *nc_in, Met2dDataFile *fr_mtddf,
                                VarInfo *vinfo, DataPlane &fr_dp, DataPlane &to_dp,
-                               Grid to_grid, IntArray *cellMapping);
+                               Grid to_grid, const CellMapping &cellMapping);
 
 static bool keep_message_type(const int mt_index);
 
@@ -173,7 +191,7 @@ static void process_goes_file(NcFile *nc_in, MetConfig &config,
 static unixtime find_valid_time(NcVar time_var);
 static ConcatString get_goes_grid_input(MetConfig config, Grid fr_grid, Grid to_grid);
 static void get_grid_mapping(Grid fr_grid, Grid to_grid,
-                             IntArray *cellMapping, ConcatString geostationary_file);
+                             CellMapping &cellMapping, ConcatString geostationary_file);
 static int  get_lat_count(NcFile *);
 static int  get_lon_count(NcFile *);
 static NcVar get_goes_nc_var(NcFile *nc, const ConcatString var_name,
@@ -183,7 +201,8 @@ static ConcatString make_geostationary_filename(Grid fr_grid, Grid to_grid,
                                                 ConcatString regrid_name);
 static void regrid_goes_variable(NcFile *nc_in, VarInfo *vinfo,
             DataPlane &fr_dp, DataPlane &to_dp,
-            Grid fr_grid, Grid to_grid, IntArray *cellMapping, NcFile *nc_adp);
+            Grid fr_grid, Grid to_grid, const CellMapping &cellMapping,
+            NcFile *nc_adp);
 static void save_geostationary_data(const ConcatString geostationary_file,
             const float *latitudes, const float *longitudes,
             const GoesImagerData grid_data);
@@ -202,6 +221,9 @@ int main(int argc, char *argv[]) {
    // Process the command line arguments
    process_command_line(argc, argv);
 
+   // Initialize OpenMP
+   init_openmp();
+
    // Process the input data file
    process_data_file();
 
@@ -723,7 +745,11 @@ void process_point_file(NcFile *nc_in, MetConfig &config, VarInfo *vinfo,
       // Loop through the requested fields
       int obs_count_zero_to, obs_count_non_zero_to;
       int obs_count_zero_from, obs_count_non_zero_from;
-      IntArray *cellMapping = (IntArray *)0;
+      CellMapping cellMapping;
+      vector<int> hdr_cells;
+
+      // The target grid cell of each header is shared by all the fields
+      get_hdr_cells(to_grid, nhdr, hdr_lats, hdr_lons, hdr_cells);
 
       obs_count_zero_to = obs_count_non_zero_to = 0;
       obs_count_zero_from = obs_count_non_zero_from = 0;
@@ -903,25 +929,10 @@ void process_point_file(NcFile *nc_in, MetConfig &config, VarInfo *vinfo,
             }
          }
 
-         if (cellMapping) {
-            for (int idx=0; idx<(nx*ny); idx++) cellMapping[idx].clear();
-            delete [] cellMapping;
-         }
-         cellMapping = new IntArray[nx * ny];
          if( get_grid_mapping(to_grid, cellMapping, var_index_array,
-                              obs_hids, hdr_lats, hdr_lons) ) {
-            int from_index;
-            IntArray cellArray;
-            NumArray dataArray;
-            int offset = 0;
-            int valid_count = 0;
-            int absent_count = 0;
-            int censored_count = 0;
-            int qc_filtered_count = 0;
-            int adp_qc_filtered_count = 0;
-            float data_value;
-            float from_min_value =  10e10;
-            float from_max_value = -10e10;
+                              nobs, obs_hids, hdr_cells) ) {
+            const ThreshArray censor_thresh = vinfo->censor_thresh();
+            const NumArray censor_val = vinfo->censor_val();
 
             // Initialize counter and output fields
             to_count = 0;
@@ -933,65 +944,58 @@ void process_point_file(NcFile *nc_in, MetConfig &config, VarInfo *vinfo,
                prob_mask_dp.set_constant(0);
             }
 
-            for (int x_idx = 0; x_idx<nx; x_idx++) {
-               for (int y_idx = 0; y_idx<ny; y_idx++) {
-                  offset = to_dp.two_to_one(x_idx,y_idx);
-                  cellArray = cellMapping[offset];
-                  int prob_cnt = 0;
-                  int prob_value_sum = 0;
-                  if (0 < cellArray.n()) {
-                     valid_count = 0;
-                     dataArray.clear();
-                     dataArray.extend(cellArray.n());
-                     for (int dIdx=0; dIdx<cellArray.n(); dIdx++) {
-                        from_index = cellArray[dIdx];
-                        data_value = obs_vals[from_index];
-                        if (is_eq(data_value, bad_data_float)) continue;
-
-                        if(mlog.verbosity_level() >= 4) {
-                           if (from_min_value > data_value) from_min_value = data_value;
-                           if (from_max_value < data_value) from_max_value = data_value;
+            // Each grid cell is reduced independently
+#pragma omp parallel reduction(+:to_count, obs_count_zero_to, obs_count_non_zero_to)
+            {
+               NumArray dataArray;
+
+#pragma omp for schedule(dynamic, 1024)
+               for (int offset=0; offset<(nx*ny); offset++) {
+                  int beg_idx = cellMapping.Offset[offset];
+                  int end_idx = cellMapping.Offset[offset+1];
+                  if (beg_idx == end_idx) continue;
+
+                  int x_idx = offset % nx;
+                  int y_idx = offset / nx;
+
+                  dataArray.erase();
+                  for (int dIdx=beg_idx; dIdx<end_idx; dIdx++) {
+                     float data_value = obs_vals[cellMapping.Index[dIdx]];
+                     if (is_eq(data_value, bad_data_float)) continue;
+
+                     for(int ic=0; ic<censor_thresh.n(); ic++) {
+                        // Break out after the first match.
+                        if(censor_thresh[ic].check(data_value)) {
+                           data_value = censor_val[ic];
+                           break;
                         }
+                     }
 
-                        for(int ic=0; ic<vinfo->censor_thresh().n(); ic++) {
-                           // Break out after the first match.
-                           if(vinfo->censor_thresh()[ic].check(data_value)) {
-                              data_value = vinfo->censor_val()[ic];
-                              censored_count++;
-                              break;
-                           }
-                        }
+                     dataArray.add(data_value);
+                  }
 
-                        dataArray.add(data_value);
-                        valid_count++;
-                     }
-                     if (0 < valid_count) to_count++;
-
-                     int data_count = dataArray.n();
-                     if (0 < data_count) {
-                        float to_value;
-                        if      (RGInfo.method == InterpMthd_Min) to_value = dataArray.min();
-                        else if (RGInfo.method == InterpMthd_Max) to_value = dataArray.max();
-                        else if (RGInfo.method == InterpMthd_Median) {
-                           dataArray.sort_array();
-                           to_value = dataArray[data_count/2];
-                           if (0 == data_count % 2)
-                              to_value = (to_value + dataArray[(data_count/2)+1])/2;
-                        }
-                        else to_value = dataArray.sum() / data_count;
-
-                        if (is_eq(to_value, 0.)) obs_count_zero_to++;
-                        else obs_count_non_zero_to++;
-
-                        cnt_dp.set(data_count, x_idx, y_idx);
-                        mask_dp.set(1, x_idx, y_idx);
-                        to_dp.set(to_value, x_idx, y_idx);
-                        if ((has_prob_thresh && prob_cat_thresh.check(to_value))
-                            || (do_gaussian_filter && !has_prob_thresh)) {
-                           prob_dp.set(1, x_idx, y_idx);
-                           prob_mask_dp.set(1, x_idx, y_idx);
-                        }
+                  int data_count = dataArray.n();
+                  if (0 == data_count) continue;
+
+                  to_count++;
+
+                  float to_value = compute_cell_value(dataArray);
+
+                  if (is_eq(to_value, 0.)) obs_count_zero_to++;
+                  else obs_count_non_zero_to++;
+
+                  cnt_dp.set(data_count, x_idx, y_idx);
+                  mask_dp.set(1, x_idx, y_idx);
+                  to_dp.set(to_value, x_idx, y_idx);
+                  if ((has_prob_thresh && prob_cat_thresh.check(to_value))
+                      || (do_gaussian_filter && !has_prob_thresh)) {
+                     prob_dp.set(1, x_idx, y_idx);
+                     prob_mask_dp.set(1, x_idx, y_idx);
+                  }
 
+                  if (mlog.verbosity_level() >= 8) {
+#pragma omp critical(point2grid_log)
+                     {
                         if (1 < data_count) {
                            mlog << Debug(9) << method_name
                                 << " to_value:" << to_value
@@ -1105,10 +1109,6 @@ void process_point_file(NcFile *nc_in, MetConfig &config, VarInfo *vinfo,
                  << (0 < filtered_count ? log_msg.c_str() : " ") << "\n";
          }
       } // end for i
-
-      if (cellMapping) {
-         delete [] cellMapping;   cellMapping = (IntArray *)0;
-      }
    }
 
    delete [] obs_ids;
@@ -1203,7 +1203,7 @@ void process_point_nccf_file(NcFile *nc_in, MetConfig &config,
       else valid_time = find_valid_time(time_var);
    }
    to_dp.set_size(to_grid.nx(), to_grid.ny());
-   IntArray *cellMapping = new IntArray[to_grid.nx() * to_grid.ny()];
+   CellMapping cellMapping;
    get_grid_mapping(fr_grid, to_grid, cellMapping, var_lat, var_lon, skip_times);
    if( skip_times ) delete [] skip_times;
    if( valid_times ) delete [] valid_times;
@@ -1287,8 +1287,6 @@ void process_point_nccf_file(NcFile *nc_in, MetConfig &config,
 
    } // end for i
 
-   delete [] cellMapping;
-   cellMapping = (IntArray *)0;
    if( 0 < filtered_by_time ) {
       mlog << Debug(2) << method_name << "Filtered by time: " << filtered_by_time
            << " out of " << from_size
@@ -1305,7 +1303,7 @@ void process_point_nccf_file(NcFile *nc_in, MetConfig &config,
 
 void regrid_nc_variable(NcFile *nc_in, Met2dDataFile *fr_mtddf,
                         VarInfo *vinfo, DataPlane &fr_dp, DataPlane &to_dp,
-                        Grid to_grid, IntArray *cellMapping) {
+                        Grid to_grid, const CellMapping &cellMapping) {
 
    int to_cell_cnt = 0;
    clock_t start_clock =  clock();
@@ -1342,77 +1340,68 @@ void regrid_nc_variable(NcFile *nc_in, Met2dDataFile *fr_mtddf,
       mlog << Debug(LEVEL_FOR_PERFORMANCE) << method_name << "took "
            << (clock()-start_clock)/double(CLOCKS_PER_SEC) << " seconds for read variable\n";
 
-      int from_index;
       int no_map_cnt = 0;
-      int censored_cnt = 0;
       int missing_cnt = 0;
       int non_missing_cnt = 0;
-      float data_value;
-      IntArray cellArray;
-      NumArray dataArray;
       float from_min_value =  10e10;
       float from_max_value = -10e10;
       int to_lat_cnt = to_grid.ny();
       int to_lon_cnt = to_grid.nx();
-      
-      missing_cnt = non_missing_cnt = 0;
+      bool check_range = (mlog.verbosity_level() >= 4);
+
       to_dp.set_constant(bad_data_double);
-      
-      for (int xIdx=0; xIdx<to_lon_cnt; xIdx++) {
-         for (int yIdx=0; yIdx<to_lat_cnt; yIdx++) {
-            int offset = to_dp.two_to_one(xIdx,yIdx);
-            cellArray = cellMapping[offset];
-            if (0 < cellArray.n()) {
-               int valid_cnt = 0;
-               dataArray.clear();
-               dataArray.extend(cellArray.n());
-               for (int dIdx=0; dIdx<cellArray.n(); dIdx++) {
-                  from_index = cellArray[dIdx];
-                  data_value = from_data[from_index];
-                  if (is_eq(data_value, bad_data_float)) {
-                     missing_cnt++;
-                     continue;
-                  }
-      
-                  dataArray.add(data_value);
-                  non_missing_cnt++;
-                  if(mlog.verbosity_level() >= 4) {
-                     if (from_min_value > data_value) from_min_value = data_value;
-                     if (from_max_value < data_value) from_max_value = data_value;
-                  }
-      
-                  valid_cnt++;
+
+      // Each grid cell is reduced independently
+#pragma omp parallel reduction(+:to_cell_cnt, no_map_cnt, missing_cnt, non_missing_cnt) \
+                     reduction(min:from_min_value) reduction(max:from_max_value)
+      {
+         NumArray dataArray;
+
+#pragma omp for schedule(dynamic, 1024)
+         for (int offset=0; offset<(to_lon_cnt*to_lat_cnt); offset++) {
+            int beg_idx = cellMapping.Offset[offset];
+            int end_idx = cellMapping.Offset[offset+1];
+            if (beg_idx == end_idx) {
+               no_map_cnt++;
+               continue;
+            }
+
+            dataArray.erase();
+            for (int dIdx=beg_idx; dIdx<end_idx; dIdx++) {
+               float data_value = from_data[cellMapping.Index[dIdx]];
+               if (is_eq(data_value, bad_data_float)) {
+                  missing_cnt++;
+                  continue;
                }
-      
-               if (0 < dataArray.n()) {
-                  int data_cnt = dataArray.n();
-                  float to_value;
-                  if      (RGInfo.method == InterpMthd_Min) to_value = dataArray.min();
-                  else if (RGInfo.method == InterpMthd_Max) to_value = dataArray.max();
-                  else if (RGInfo.method == InterpMthd_Median) {
-                     dataArray.sort_array();
-                     to_value = dataArray[data_cnt/2];
-                     if (0 == data_cnt % 2)
-                        to_value = (to_value + dataArray[(data_cnt/2)+1])/2;
-                  }
-                  else to_value = dataArray.sum() / data_cnt;    // UW_Mean
-      
-                  to_dp.set(to_value, xIdx, yIdx);
-                  to_cell_cnt++;
-                  mlog << Debug(9) << method_name
-                       <<   "max: " << dataArray.max()
-                       << ", min: " << dataArray.min()
-                       << ", mean: " << dataArray.sum()/data_cnt
-                       << " from " << valid_cnt << " out of "
-                       << data_cnt << " data values.\n";
+
+               dataArray.add(data_value);
+               non_missing_cnt++;
+               if (check_range) {
+                  if (from_min_value > data_value) from_min_value = data_value;
+                  if (from_max_value < data_value) from_max_value = data_value;
                }
             }
-            else {
-               no_map_cnt++;
+
+            int data_cnt = dataArray.n();
+            if (0 == data_cnt) continue;
+
+            float to_value = compute_cell_value(dataArray);
+
+            to_dp.set(to_value, offset % to_lon_cnt, offset / to_lon_cnt);
+            to_cell_cnt++;
+
+            if (mlog.verbosity_level() >= 9) {
+#pragma omp critical(point2grid_log)
+               mlog << Debug(9) << method_name
+                    <<   "max: " << dataArray.max()
+                    << ", min: " << dataArray.min()
+                    << ", mean: " << dataArray.sum()/data_cnt
+                    << " from " << data_cnt << " out of "
+                    << (end_idx - beg_idx) << " data values.\n";
             }
          }
       }
-      
+
       delete [] from_data;
       
       mlog << Debug(4) << method_name << "[Count] data cells: " << to_cell_cnt
@@ -1608,7 +1597,7 @@ void process_goes_file(NcFile *nc_in, MetConfig &config, VarInfo *vinfo,
    unixtime valid_time = find_valid_time(time_var);
    to_dp.set_size(to_grid.nx(), to_grid.ny());
    global_attr_count =  sizeof(GOES_global_attr_names)/sizeof(*GOES_global_attr_names);
-   IntArray *cellMapping = new IntArray[to_grid.nx() * to_grid.ny()];
+   CellMapping cellMapping;
    get_grid_mapping(fr_grid, to_grid, cellMapping, geostationary_file);
 
    // Loop through the requested fields
@@ -1712,7 +1701,6 @@ void process_goes_file(NcFile *nc_in, MetConfig &config, VarInfo *vinfo,
    //copy_nc_atts(_nc_in, nc_out, opt_all_attrs);
 
    delete nc_adp; nc_adp = 0;
-   delete [] cellMapping;   cellMapping = (IntArray *)0;
    mlog << Debug(LEVEL_FOR_PERFORMANCE) << method_name << "took "
         << (clock()-start_clock)/double(CLOCKS_PER_SEC) << " seconds\n";
 
@@ -1779,46 +1767,65 @@ static unixtime compute_unixtime(NcVar *time_var, unixtime var_value) {
 
 ////////////////////////////////////////////////////////////////////////
 
-static bool get_grid_mapping(Grid to_grid, IntArray *cellMapping,
-                             const IntArray obs_index_array, const int *obs_hids,
-                             const float *hdr_lats, const float *hdr_lons) {
+static void get_hdr_cells(Grid to_grid, int nhdr, const float *hdr_lats,
+                          const float *hdr_lons, vector<int> &hdr_cells) {
+   clock_t start_clock =  clock();
+   int to_lat_count = to_grid.ny();
+   int to_lon_count = to_grid.nx();
+   static const char *method_name = "get_hdr_cells() -> ";
+
+   hdr_cells.assign(nhdr, bad_data_int);
+
+   // Grid cell of each header, or bad data when outside of the grid
+#pragma omp parallel for schedule(static)
+   for (int hdr_idx=0; hdr_idx<nhdr; hdr_idx++) {
+      double x, y;
+      float lat = hdr_lats[hdr_idx];
+      float lon = hdr_lons[hdr_idx];
+      if( lat < MISSING_LATLON || lon < MISSING_LATLON ) continue;
+      to_grid.latlon_to_xy(lat, -1.0*lon, x, y);
+      int idx_x = nint(x);
+      int idx_y = nint(y);
+      if (0 <= idx_x && idx_x < to_lon_count && 0 <= idx_y && idx_y < to_lat_count) {
+         hdr_cells[hdr_idx] = idx_y * to_lon_count + idx_x;
+      }
+   }
+
+   mlog << Debug(LEVEL_FOR_PERFORMANCE) << method_name << "took "
+        << (clock()-start_clock)/double(CLOCKS_PER_SEC) << " seconds\n";
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static bool get_grid_mapping(Grid to_grid, CellMapping &cellMapping,
+                             const IntArray &obs_index_array, int nobs,
+                             const int *obs_hids, const vector<int> &hdr_cells) {
    bool status = false;
    clock_t start_clock =  clock();
+   int to_size = to_grid.nx() * to_grid.ny();
    static const char *method_name = "get_grid_mapping(MET_obs) -> ";
 
    int obs_count = obs_index_array.n();
    if (0 == obs_count) {
+      build_cell_mapping(cellMapping, to_size, vector<int>());
       mlog << Warning << "\n" << method_name
            << "no valid point observation data!\n\n";
       return status;
    }
 
-   int hdr_idx, obs_idx;
-   int count_in_grid;
-   double x, y;
-   float  lat, lon;
-   DataPlane to_dp;
-   int to_offset, idx_x, idx_y;
-   int to_lat_count = to_grid.ny();
-   int to_lon_count = to_grid.nx();
+   int obs_idx, to_offset;
+   int count_in_grid = 0;
+   vector<int> from_cells(nobs, bad_data_int);
 
-   count_in_grid = 0;
-   to_dp.set_size(to_lon_count, to_lat_count);
    for (int idx=0; idx<obs_count; idx++) {
       obs_idx = obs_index_array[idx];
-      hdr_idx = obs_hids[obs_idx];
-      lat = hdr_lats[hdr_idx];
-      lon = hdr_lons[hdr_idx];
-      if( lat < MISSING_LATLON || lon < MISSING_LATLON ) continue;
-      to_grid.latlon_to_xy(lat, -1.0*lon, x, y);
-      idx_x = nint(x);
-      idx_y = nint(y);
-      if (0 <= idx_x && idx_x < to_lon_count && 0 <= idx_y && idx_y < to_lat_count) {
-         to_offset = to_dp.two_to_one(idx_x, idx_y);
-         cellMapping[to_offset].add(obs_idx);
+      to_offset = hdr_cells[obs_hids[obs_idx]];
+      if (to_offset != bad_data_int) {
+         from_cells[obs_idx] = to_offset;
          count_in_grid++;
       }
    }
+   build_cell_mapping(cellMapping, to_size, from_cells);
 
    if (0 == count_in_grid)
       mlog << Warning << "\n" << method_name
@@ -1834,16 +1841,81 @@ static bool get_grid_mapping(Grid to_grid, IntArray *cellMapping,
    return status;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Store the input points for each cell with a counting sort: count
+// the points in each cell, turn the counts into offsets, and then fill
+// in the input indices in ascending order.  from_cells holds the cell
+// for each input point or bad data when it is not mapped.
+//
+////////////////////////////////////////////////////////////////////////
+
+static void build_cell_mapping(CellMapping &cellMapping, int n_cells,
+                               const vector<int> &from_cells) {
+   int idx, to_offset;
+   int from_count = (int) from_cells.size();
+   static const char *method_name = "build_cell_mapping() -> ";
+
+   cellMapping.Offset.assign(n_cells + 1, 0);
+
+   for (idx=0; idx<from_count; idx++) {
+      to_offset = from_cells[idx];
+      if( to_offset == bad_data_int ) continue;
+      if( to_offset < 0 || to_offset >= n_cells ) {
+         mlog << Error << "\n" << method_name
+              << "the mapped cell is out of range: "
+              << to_offset << " at " << idx << "\n\n";
+         exit(1);
+      }
+      cellMapping.Offset[to_offset + 1]++;
+   }
+
+   for (idx=0; idx<n_cells; idx++) {
+      cellMapping.Offset[idx + 1] += cellMapping.Offset[idx];
+   }
+
+   vector<int> next_index(cellMapping.Offset.begin(), cellMapping.Offset.end() - 1);
+
+   cellMapping.Index.resize(cellMapping.Offset[n_cells]);
+   for (idx=0; idx<from_count; idx++) {
+      to_offset = from_cells[idx];
+      if( to_offset == bad_data_int ) continue;
+      cellMapping.Index[next_index[to_offset]++] = idx;
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Combine the valid values for one grid cell using the requested
+// method.  The values are sorted in place for the median.
+//
+////////////////////////////////////////////////////////////////////////
+
+static float compute_cell_value(NumArray &dataArray) {
+   float to_value;
+   int data_count = dataArray.n();
+
+   if      (RGInfo.method == InterpMthd_Min) to_value = dataArray.min();
+   else if (RGInfo.method == InterpMthd_Max) to_value = dataArray.max();
+   else if (RGInfo.method == InterpMthd_Median) {
+      dataArray.sort_array();
+      to_value = dataArray[data_count/2];
+      if (0 == data_count % 2)
+         to_value = (to_value + dataArray[(data_count/2)-1])/2;
+   }
+   else to_value = dataArray.sum() / data_count;    // UW_Mean
+
+   return to_value;
+}
 
 ////////////////////////////////////////////////////////////////////////
 
 static void get_grid_mapping_latlon(
-      DataPlane from_dp, DataPlane to_dp, Grid to_grid,
-      IntArray *cellMapping, float *latitudes, float *longitudes,
-      int from_lat_count, int from_lon_count, bool *skip_times, bool to_north) {
-   double x, y;
-   float lat, lon;
-   int idx_x, idx_y, to_offset;
+      Grid to_grid, CellMapping &cellMapping,
+      float *latitudes, float *longitudes,
+      int from_lat_count, int from_lon_count, bool *skip_times) {
    int count_in_grid = 0;
    clock_t start_clock =  clock();
    int to_lat_count = to_grid.ny();
@@ -1852,72 +1924,30 @@ static void get_grid_mapping_latlon(
    int data_size  = from_lat_count * from_lon_count;
    static const char *method_name = "get_grid_mapping(lats, lons) -> ";
 
-   int *to_cell_counts = new int[to_size];
-   int *mapping_indices = new int[data_size];
-   for (int xIdx=0; xIdx<to_size; xIdx++) to_cell_counts[xIdx] = 0;
-   for (int xIdx=0; xIdx<data_size; xIdx++) mapping_indices[xIdx] = bad_data_int;
-
-   //Count the number of cells to be mapped to TO_GRID
-   //Following the logic at DataPlane::two_to_one(int x, int y) n = y*Nx + x;
-   for (int xIdx=0; xIdx<from_lat_count; xIdx++) {
-      for (int yIdx=0; yIdx<from_lon_count; yIdx++) {
-         int coord_offset = from_dp.two_to_one(yIdx, xIdx, to_north);
-         if( skip_times != 0 && skip_times[coord_offset] ) continue;
-         lat = latitudes[coord_offset];
-         lon = longitudes[coord_offset];
-         if( lat < MISSING_LATLON || lon < MISSING_LATLON ) continue;
-         to_grid.latlon_to_xy(lat, -1.0*lon, x, y);
-         idx_x = nint(x);
-         idx_y = nint(y);
-         if (0 <= idx_x && idx_x < to_lon_count && 0 <= idx_y && idx_y < to_lat_count) {
-            to_offset = to_dp.two_to_one(idx_x, idx_y);
-            mapping_indices[coord_offset] = to_offset;
-            to_cell_counts[to_offset] += 1;
-            count_in_grid++;
-         }
+   vector<int> from_cells(data_size, bad_data_int);
+
+   // Find the TO_GRID cell for each input point.
+   // Following the logic at DataPlane::two_to_one(int x, int y) n = y*Nx + x;
+#pragma omp parallel for schedule(static) reduction(+:count_in_grid)
+   for (int coord_offset=0; coord_offset<data_size; coord_offset++) {
+      double x, y;
+      if( skip_times != 0 && skip_times[coord_offset] ) continue;
+      float lat = latitudes[coord_offset];
+      float lon = longitudes[coord_offset];
+      if( lat < MISSING_LATLON || lon < MISSING_LATLON ) continue;
+      to_grid.latlon_to_xy(lat, -1.0*lon, x, y);
+      int idx_x = nint(x);
+      int idx_y = nint(y);
+      if (0 <= idx_x && idx_x < to_lon_count && 0 <= idx_y && idx_y < to_lat_count) {
+         from_cells[coord_offset] = idx_y * to_lon_count + idx_x;
+         count_in_grid++;
       }
    }
    mlog << Debug(LEVEL_FOR_PERFORMANCE+2) << method_name << "took "
         << (clock()-start_clock)/double(CLOCKS_PER_SEC) << " seconds for mapping cells\n";
 
-   // Count the mapping cells for each to_cell and prepare IntArray
-   int max_count = 0;
-   clock_t tmp_clock =  clock();
-   for (int xIdx=0; xIdx<to_size; xIdx++) {
-      int cell_count = to_cell_counts[xIdx];
-      if( cell_count > 0 ) {
-         cellMapping[xIdx].extend(cell_count+1);
-         if( cell_count > 32768 ) {
-            mlog << Debug(LEVEL_FOR_PERFORMANCE+1) << method_name
-                 << "extent IntArray to " << cell_count << " at " << xIdx << "\n";
-         }
-         if( max_count < cell_count ) max_count = cell_count;
-      }
-      else if( cell_count < 0 ) {
-         mlog << Error << "\n" << method_name
-              << "the mapping cell count can not be negative "
-              << cell_count << " at " << xIdx << "\n\n";
-         exit(1);
-      }
-   }
-   mlog << Debug(LEVEL_FOR_PERFORMANCE+1) << method_name << "took "
-        << (clock()-tmp_clock)/double(CLOCKS_PER_SEC)
-        << " seconds for extending IntArray (max_cells=" << max_count << ")\n";
-
    // Build cell mapping
-   for (int xIdx=0; xIdx<data_size; xIdx++) {
-      to_offset = mapping_indices[xIdx];
-      if( to_offset == bad_data_int ) continue;
-      if( to_offset < 0 || to_offset >= to_size ) {
-         mlog << Error << "\n" << method_name
-              << "the mapped cell is out of range: "
-              << to_offset << " at " << xIdx << "\n\n";
-         exit(1);
-      }
-      else cellMapping[to_offset].add(xIdx);
-   }
-   delete [] to_cell_counts;
-   delete [] mapping_indices;
+   build_cell_mapping(cellMapping, to_size, from_cells);
 
    mlog << Debug(3) << method_name << "within grid: " << count_in_grid
         << " out of " << data_size << " (" << 1.0*count_in_grid/data_size*100 << "%)\n";
@@ -1927,10 +1957,9 @@ static void get_grid_mapping_latlon(
 
 ////////////////////////////////////////////////////////////////////////
 
-static bool get_grid_mapping(Grid fr_grid, Grid to_grid, IntArray *cellMapping,
+static bool get_grid_mapping(Grid fr_grid, Grid to_grid, CellMapping &cellMapping,
                              NcVar var_lat, NcVar var_lon, bool *skip_times) {
    bool status = false;
-   DataPlane from_dp, to_dp;
    ConcatString cur_coord_name;
    clock_t start_clock =  clock();
    static const char *method_name = "get_grid_mapping(var_lat, var_lon) -> ";
@@ -1947,8 +1976,7 @@ static bool get_grid_mapping(Grid fr_grid, Grid to_grid, IntArray *cellMapping,
         << "                    target grid (nx,ny): " << to_lon_count * to_lat_count
         << " = " << to_lon_count << " * " << to_lat_count << "\n";
 
-   from_dp.set_size(from_lon_count, from_lat_count);
-   to_dp.set_size(to_lon_count, to_lat_count);
+   build_cell_mapping(cellMapping, to_lon_count * to_lat_count, vector<int>());
 
    if (IS_INVALID_NC(var_lat)) {
       mlog << Error << "\n" << method_name
@@ -1966,10 +1994,9 @@ static bool get_grid_mapping(Grid fr_grid, Grid to_grid, IntArray *cellMapping,
       status = get_nc_data(&var_lat, latitudes);
       if( status ) status = get_nc_data(&var_lon, longitudes);
       if( status ) {
-         get_grid_mapping_latlon(from_dp, to_dp, to_grid, cellMapping,
+         get_grid_mapping_latlon(to_grid, cellMapping,
                                  latitudes, longitudes, from_lat_count,
-                                 from_lon_count, skip_times,
-                                 !fr_grid.get_swap_to_north());
+                                 from_lon_count, skip_times);
       }
       if( latitudes )  delete [] latitudes;
       if( longitudes ) delete [] longitudes;
@@ -2032,10 +2059,9 @@ ConcatString get_goes_grid_input(MetConfig config, Grid fr_grid, Grid to_grid) {
 
 ////////////////////////////////////////////////////////////////////////
 
-void get_grid_mapping(Grid fr_grid, Grid to_grid, IntArray *cellMapping,
+void get_grid_mapping(Grid fr_grid, Grid to_grid, CellMapping &cellMapping,
                       ConcatString geostationary_file) {
    static const char *method_name = "get_grid_mapping() -> ";
-   DataPlane from_dp, to_dp;
    ConcatString cur_coord_name;
 
    clock_t start_clock =  clock();
@@ -2076,8 +2102,7 @@ void get_grid_mapping(Grid fr_grid, Grid to_grid, IntArray *cellMapping,
         << "                    target grid (nx,ny): " << to_lon_count * to_lat_count
         << " = " << to_lon_count << " * " << to_lat_count << "\n";
 
-   from_dp.set_size(from_lon_count, from_lat_count);
-   to_dp.set_size(to_lon_count, to_lat_count);
+   build_cell_mapping(cellMapping, to_lon_count * to_lat_count, vector<int>());
 
    if (data_size > 0) {
       float  *latitudes  = (float *)NULL;
@@ -2179,9 +2204,8 @@ void get_grid_mapping(Grid fr_grid, Grid to_grid, IntArray *cellMapping,
       }
       else {
          check_lat_lon(data_size, latitudes, longitudes);
-         get_grid_mapping_latlon(from_dp, to_dp, to_grid, cellMapping, latitudes,
-                                 longitudes, from_lat_count, from_lon_count, 0,
-                                 !fr_grid.get_swap_to_north());
+         get_grid_mapping_latlon(to_grid, cellMapping, latitudes,
+                                 longitudes, from_lat_count, from_lon_count, 0);
       }
 
       if (latitudes_buf)  delete [] latitudes_buf;
@@ -2297,7 +2321,8 @@ static bool is_time_mismatch(NcFile *nc_in, NcFile *nc_adp) {
 
 void regrid_goes_variable(NcFile *nc_in, VarInfo *vinfo,
       DataPlane &fr_dp, DataPlane &to_dp,
-      Grid fr_grid, Grid to_grid, IntArray *cellMapping, NcFile *nc_adp) {
+      Grid fr_grid, Grid to_grid, const CellMapping &cellMapping,
+      NcFile *nc_adp) {
 
    bool has_qc_var = false;
    bool has_adp_qc_var = false;
@@ -2310,7 +2335,6 @@ void regrid_goes_variable(NcFile *nc_in, VarInfo *vinfo,
    ConcatString goes_var_name;
    ConcatString goes_var_sub_name;
    ConcatString qc_var_name;
-   uchar qc_value;
    uchar *qc_data = new uchar[from_data_size];
    uchar *adp_data = new uchar[from_data_size];
    float *from_data = new float[from_data_size];
@@ -2390,7 +2414,6 @@ void regrid_goes_variable(NcFile *nc_in, VarInfo *vinfo,
       }
    }
 
-   int from_index;
    int absent_count = 0;
    int censored_count = 0;
    int missing_count = 0;
@@ -2398,104 +2421,104 @@ void regrid_goes_variable(NcFile *nc_in, VarInfo *vinfo,
    int non_missing_count = 0;
    int qc_filtered_count = 0;
    int adp_qc_filtered_count = 0;
-   float data_value;
    float from_min_value =  10e10;
    float from_max_value = -10e10;
    float qc_min_value =  10e10;
    float qc_max_value = -10e10;
-   IntArray cellArray;
-   NumArray dataArray;
-   int particle_qc;
    bool has_qc_flags = (qc_flags.n() > 0);
+   bool check_range = (mlog.verbosity_level() >= 4);
+   const ThreshArray censor_thresh = vinfo->censor_thresh();
+   const NumArray censor_val = vinfo->censor_val();
 
-   missing_count = non_missing_count = 0;
    to_dp.set_constant(bad_data_double);
 
-   for (int xIdx=0; xIdx<to_lon_count; xIdx++) {
-      for (int yIdx=0; yIdx<to_lat_count; yIdx++) {
-         int offset = to_dp.two_to_one(xIdx,yIdx);
-         cellArray = cellMapping[offset];
-         if (0 < cellArray.n()) {
-            int valid_count = 0;
-            dataArray.clear();
-            dataArray.extend(cellArray.n());
-            for (int dIdx=0; dIdx<cellArray.n(); dIdx++) {
-               from_index = cellArray[dIdx];
-               data_value = from_data[from_index];
-               if (is_eq(data_value, bad_data_float)) {
-                  missing_count++;
-                  continue;
-               }
+   // Each grid cell is reduced independently
+#pragma omp parallel reduction(+:absent_count, censored_count, missing_count, \
+                                 to_cell_count, non_missing_count, \
+                                 qc_filtered_count, adp_qc_filtered_count) \
+                     reduction(min:from_min_value, qc_min_value) \
+                     reduction(max:from_max_value, qc_max_value)
+   {
+      NumArray dataArray;
 
-               non_missing_count++;
-               if(mlog.verbosity_level() >= 4) {
-                  if (from_min_value > data_value) from_min_value = data_value;
-                  if (from_max_value < data_value) from_max_value = data_value;
-               }
+#pragma omp for schedule(dynamic, 1024)
+      for (int offset=0; offset<(to_lon_count*to_lat_count); offset++) {
+         int beg_idx = cellMapping.Offset[offset];
+         int end_idx = cellMapping.Offset[offset+1];
+         if (beg_idx == end_idx) continue;
+
+         int valid_count = 0;
+         dataArray.erase();
+         for (int dIdx=beg_idx; dIdx<end_idx; dIdx++) {
+            int from_index = cellMapping.Index[dIdx];
+            float data_value = from_data[from_index];
+            if (is_eq(data_value, bad_data_float)) {
+               missing_count++;
+               continue;
+            }
 
-               // Filter by QC flag
-               qc_value = qc_data[from_index];
-               if (!has_qc_var || !has_qc_flags || qc_flags.has(qc_value)) {
-                  for(int i=0; i<vinfo->censor_thresh().n(); i++) {
-                     // Break out after the first match.
-                     if(vinfo->censor_thresh()[i].check(data_value)) {
-                        data_value = vinfo->censor_val()[i];
-                        censored_count++;
-                        break;
-                     }
-                  }
-                  if (0 == adp_data[from_index]) {
-                     absent_count++;
-                     continue;
-                  }
+            non_missing_count++;
+            if (check_range) {
+               if (from_min_value > data_value) from_min_value = data_value;
+               if (from_max_value < data_value) from_max_value = data_value;
+            }
 
-                  if (has_adp_qc_var && has_qc_flags) {
-                     int shift_bits = 2;
-                     if (is_dust_only) shift_bits += 2;
-                     particle_qc = ((adp_qc_data[from_index] >> shift_bits) & 0x03);
-                     int qc_for_flag = 3 - particle_qc; // high = 3, qc_flag for high = 0
-                     if (!qc_flags.has(qc_for_flag)) {
-                        adp_qc_filtered_count++;
-                        continue;
-                     }
+            // Filter by QC flag
+            uchar qc_value = qc_data[from_index];
+            if (!has_qc_var || !has_qc_flags || qc_flags.has(qc_value)) {
+               for(int i=0; i<censor_thresh.n(); i++) {
+                  // Break out after the first match.
+                  if(censor_thresh[i].check(data_value)) {
+                     data_value = censor_val[i];
+                     censored_count++;
+                     break;
                   }
+               }
+               if (0 == adp_data[from_index]) {
+                  absent_count++;
+                  continue;
+               }
 
-                  dataArray.add(data_value);
-                  if (mlog.verbosity_level() >= 4) {
-                     if (qc_min_value > qc_value) qc_min_value = qc_value;
-                     if (qc_max_value < qc_value) qc_max_value = qc_value;
+               if (has_adp_qc_var && has_qc_flags) {
+                  int shift_bits = 2;
+                  if (is_dust_only) shift_bits += 2;
+                  int particle_qc = ((adp_qc_data[from_index] >> shift_bits) & 0x03);
+                  int qc_for_flag = 3 - particle_qc; // high = 3, qc_flag for high = 0
+                  if (!qc_flags.has(qc_for_flag)) {
+                     adp_qc_filtered_count++;
+                     continue;
                   }
                }
-               else {
-                  qc_filtered_count++;
+
+               dataArray.add(data_value);
+               if (check_range) {
+                  if (qc_min_value > qc_value) qc_min_value = qc_value;
+                  if (qc_max_value < qc_value) qc_max_value = qc_value;
                }
-               valid_count++;
             }
+            else {
+               qc_filtered_count++;
+            }
+            valid_count++;
+         }
 
-            if (0 < dataArray.n()) {
-               int data_count = dataArray.n();
-               float to_value;
-               if      (RGInfo.method == InterpMthd_Min) to_value = dataArray.min();
-               else if (RGInfo.method == InterpMthd_Max) to_value = dataArray.max();
-               else if (RGInfo.method == InterpMthd_Median) {
-                  dataArray.sort_array();
-                  to_value = dataArray[data_count/2];
-                  if (0 == data_count % 2)
-                     to_value = (to_value + dataArray[(data_count/2)+1])/2;
-               }
-               else to_value = dataArray.sum() / data_count; // UW_Mean
+         int data_count = dataArray.n();
+         if (0 == data_count) continue;
 
-               to_dp.set(to_value, xIdx, yIdx);
-               to_cell_count++;
-               mlog << Debug(9) << method_name
-                    <<   "max: " << dataArray.max()
-                    << ", min: " << dataArray.min()
-                    << ", mean: " << dataArray.sum()/data_count
-                    << " from " << valid_count << " out of "
-                    << data_count << " data values.\n";
-            }
+         float to_value = compute_cell_value(dataArray);
+
+         to_dp.set(to_value, offset % to_lon_count, offset / to_lon_count);
+         to_cell_count++;
+
+         if (mlog.verbosity_level() >= 9) {
+#pragma omp critical(point2grid_log)
+            mlog << Debug(9) << method_name
+                 <<   "max: " << dataArray.max()
+                 << ", min: " << dataArray.min()
+                 << ", mean: " << dataArray.sum()/data_count
+                 << " from " << valid_count << " out of "
+                 << data_count << " data values.\n";
          }
-         else {}
       }
    }
 